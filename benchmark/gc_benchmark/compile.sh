@@ -1,3 +1,5 @@
 # bun    -> bun bun_benchmark.js
 # go     -> golan build golan_benchmark.go ; ./golan_benchmark
-# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
\ No newline at end of file
+# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
+# nodepp (queue) -> g++ -o main nodepp_queue_benchmark.cpp -O3 -mtune=native -march=native ; ./main
+# nodepp (array) -> g++ -o main nodepp_array_benchmark.cpp -O3 -mtune=native -march=native ; ./main
@@ -0,0 +1,27 @@
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+ulong benchmark_nodepp( int iterations ) {
+
+    array_t<int> arr; string_t str;
+    auto start = process::micros();
+
+    for( int i = 0; i < iterations; i++ ) {
+		// append-heavy building, as seen in json::stringify and write_header
+         arr.push( i ); str.push( 'a' + i % 26 );
+    }
+
+    auto end = process::micros();
+    return ( end - start ) / 1000UL;
+
+}
+
+void onMain() {
+
+    for( int x=0; x <= 100; x++ ){
+        ulong d = benchmark_nodepp( 1000000 );
+        console::log( x, "Nodepp Time:", d, "ms" );
+    }
+
+}
@@ -0,0 +1,28 @@
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+ulong benchmark_nodepp( int iterations, bool slab ) {
+
+    queue_t<ulong> queue; queue.set_slab( slab );
+    auto start = process::micros();
+
+    for( int i = 0; i < iterations; i++ ) {
+		// queue node churn, as seen in loop_t and event_t under load
+         queue.push( i ); if( queue.size() > 64 ){ queue.shift(); }
+    }
+
+    auto end = process::micros();
+    return ( end - start ) / 1000UL;
+
+}
+
+void onMain() {
+
+    for( int x=0; x <= 1000; x++ ){
+        ulong a = benchmark_nodepp( 100000, false );
+        ulong b = benchmark_nodepp( 100000, true  );
+        console::log( x, "Nodepp Time:", a, "ms | slab:", b, "ms" );
+    }
+
+}
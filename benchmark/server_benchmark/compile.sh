@@ -1,3 +1,5 @@
 # bun    -> bun bun_benchmark.js
 # go     -> golan build golan_benchmark.go ; ./golan_benchmark
-# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
\ No newline at end of file
+# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
+# nodepp (io_uring) -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native -DNODEPP_POLL_URING ; ./main
+# nodepp (cluster) -> g++ -o main nodepp_cluster_benchmark.cpp -O3 -mtune=native -march=native -lpthread ; ./main 
@@ -0,0 +1,22 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/shard.h>
+#include <nodepp/http.h>
+
+using namespace nodepp;
+
+void onMain(){
+
+    auto server = tcp::cluster_listen( "localhost", 8000, os::cpus(), [=](){
+    return http::server([=]( http_t cli ){ 
+        
+        cli.write_header( 200, header_t({
+            { "content-type", "text/html" }
+        }));
+        
+        cli.write( "<h1>Hello, World!</h1>" );
+
+    }); }, true );
+
+    console::log("server started at http://localhost:8000 (", server.threads(), "threads )");
+
+}
@@ -1,3 +1,4 @@
 # bun    -> bun bun_benchmark.js
 # go     -> golan build golan_benchmark.go ; ./golan_benchmark
-# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
\ No newline at end of file
+# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
+# nodepp (scheduler) -> g++ -o main nodepp_scheduler_benchmark.cpp -O3 -mtune=native -march=native -lpthread ; ./main
@@ -0,0 +1,24 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/scheduler.h>
+
+using namespace nodepp;
+
+void onMain() {
+
+    scheduler_t sch; int x=100000; while( x-->0 ){ 
+
+    sch.add( coroutine::add( COROUTINE(){
+    coBegin
+
+        while( true ){ 
+            console::log( "hello world!", x );
+        coDelay( 10 ); }
+
+    coFinish
+    }));
+
+    }
+
+    sch.await();
+
+}
@@ -0,0 +1 @@
+# nodepp -> g++ -o main nodepp_benchmark.cpp -O3 -mtune=native -march=native ; ./main 
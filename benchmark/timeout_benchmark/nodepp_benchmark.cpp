@@ -0,0 +1,39 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/socket.h>
+
+using namespace nodepp;
+
+void onMain() {
+
+    limit::set_soft_fileno( limit::get_hard_fileno() );
+    int total = min( 100000, (int)limit::get_soft_fileno() - 64 );
+
+    auto count = type::bind( 0 );
+    auto start = process::micros();
+
+    for( int x=0; x<total; x++ ){
+
+        socket_t sk ( ::socket( AF_INET, SOCK_DGRAM, 0 ), 0 );
+        sk.onDrain.once([=](){ (*count)++; });
+
+        process::poll( sk, POLL_STATE::READ, [=](){
+            return sk.is_closed() ? -1 : 0;
+        }, 1000 + ( x % 5000 ) );
+
+    }
+
+    console::log( total, "sockets registered in", ( process::micros() - start ) / 1000UL, "ms" );
+
+    process::add( coroutine::add( COROUTINE(){
+    coBegin
+
+        while( *count < total ){ coDelay( 1000 );
+            console::log( *count, "sockets expired" );
+        }
+
+        console::log( "all sockets expired in", ( process::micros() - start ) / 1000UL, "ms" );
+
+    coFinish
+    }));
+
+}
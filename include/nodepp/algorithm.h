@@ -0,0 +1,190 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_ALGORITHM
+#define NODEPP_ALGORITHM
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace algorithm {
+
+    /* cmp( a, b ) answers "does a go before b". A non-strict cmp ( a<=b ) *
+     * is spotted by cmp( x, x ) and turned into the strict !cmp( b, a ),  *
+     * so both sort the same way and the merge sorts stay stable.          */
+
+    enum SORT {
+         SORT_INSERTION = 24,
+         SORT_PARTIAL   = 8
+    };
+
+    template< class F > struct NODE_STRICT { F& cmp;
+        template< class T > bool operator()( const T& a, const T& b ) const { return !cmp( b, a ); }
+    };
+
+    template< class T, class F >
+    void insertion_sort( T* a, ulong n, F& cmp ) {
+        for( ulong i=1; i<n; ++i ){ if( !cmp( a[i], a[i-1] ) ){ continue; }
+             T x = a[i]; ulong j = i; do { a[j] = a[j-1]; --j; }
+             while( j>0 && cmp( x, a[j-1] ) ); a[j] = x;
+        }
+    }
+
+    /* gives up after SORT_PARTIAL moves: used to finish a range that the *
+     * last partition found already in order, and to bail out otherwise. */
+
+    template< class T, class F >
+    bool partial_insertion_sort( T* a, ulong n, F& cmp ) { ulong moves=0;
+        for( ulong i=1; i<n; ++i ){ if( !cmp( a[i], a[i-1] ) ){ continue; }
+             T x = a[i]; ulong j = i; do { a[j] = a[j-1]; --j; }
+             while( j>0 && cmp( x, a[j-1] ) ); a[j] = x;
+             moves += i - j; if( moves > SORT_PARTIAL ){ return false; }
+        }    return true;
+    }
+
+    template< class T, class F >
+    void sift_down( T* a, ulong root, ulong n, F& cmp ) {
+        T x = a[root]; while( root*2+1 < n ){ ulong child = root*2+1;
+        if( child+1<n && cmp( a[child], a[child+1] ) ){ ++child; }
+        if( !cmp( x, a[child] ) ){ break; } a[root] = a[child]; root = child;
+        }   a[root] = x;
+    }
+
+    template< class T, class F >
+    void heap_sort( T* a, ulong n, F& cmp ) {
+        if( n<2 ){ return; } ulong x = n/2;
+        while( x-->0 ){ sift_down( a, x, n, cmp ); }
+        while( n-->1 ){ type::swap( a[0], a[n] ); sift_down( a, 0, n, cmp ); }
+    }
+
+    /*─······································································─*/
+
+    template< class T, class F >
+    void sort_3( T& a, T& b, T& c, F& cmp ) {
+        if( cmp( b, a ) ){ type::swap( a, b ); }
+        if( cmp( c, b ) ){ type::swap( b, c );
+        if( cmp( b, a ) ){ type::swap( a, b ); }}
+    }
+
+    /* introsort with median-of-3 ( ninther on large ranges ) pivots and  *
+     * the pdqsort shortcut for ranges a partition left untouched. Falls  *
+     * back to heap_sort once the depth budget runs out.                  */
+
+    template< class T, class F >
+    void intro_sort( T* a, ulong n, F& cmp, uint depth ) {
+        while( n > SORT_INSERTION ){
+
+            if( depth-- == 0 ){ heap_sort( a, n, cmp ); return; }
+
+            ulong m = n / 2; if( n > 128 ){ ulong s = n / 8;
+                sort_3( a[0], a[s], a[s*2], cmp );
+                sort_3( a[m-s], a[m], a[m+s], cmp );
+                sort_3( a[n-1-s*2], a[n-1-s], a[n-1], cmp );
+                sort_3( a[s], a[m], a[n-1-s], cmp );
+            } else { sort_3( a[0], a[m], a[n-1], cmp ); }
+
+            T pivot = a[m]; long i=-1, j=n; bool swapped=false;
+            while( true ){
+                do { ++i; } while( (ulong) i < n-1 && cmp( a[i], pivot ) );
+                do { --j; } while( j > 0 && cmp( pivot, a[j] ) );
+                if( i >= j ){ break; } type::swap( a[i], a[j] ); swapped=true;
+            }
+
+            ulong left = j + 1, right = n - left;
+            if( !swapped && partial_insertion_sort( a, left, cmp )
+                         && partial_insertion_sort( a + left, right, cmp ) ){ return; }
+
+            if( left < right ){ intro_sort( a, left, cmp, depth ); a += left; n = right; }
+            else /*-------*/ { intro_sort( a + left, right, cmp, depth ); n = left; }
+
+        }   insertion_sort( a, n, cmp );
+    }
+
+    template< class T, class F >
+    void sort( T* a, ulong n, F cmp ) {
+        uint depth = 0; ulong x = n; while( x>1 ){ x >>= 1; depth += 2; }
+        if( n>1 && cmp( a[0], a[0] ) ){ NODE_STRICT<F> strict {cmp};
+              intro_sort( a, n, strict, depth ); }
+        else{ intro_sort( a, n, cmp, depth ); }
+    }
+
+    /*─······································································─*/
+
+    /* bottom-up merge sort: SORT_INSERTION-wide runs are insertion sorted *
+     * in place, then merged pairwise between a and one n-sized buffer.    */
+
+    template< class T, class F >
+    void merge_sort( T* a, ulong n, F& cmp ) {
+        for( ulong x=0; x<n; x+=SORT_INSERTION )
+          { insertion_sort( a + x, min( (ulong) SORT_INSERTION, n-x ), cmp ); }
+        if( n<=SORT_INSERTION ){ return; }
+
+        ptr_t<T> buff( n ); T* src = a; T* des = &buff;
+        for( ulong w=SORT_INSERTION; w<n; w*=2 ){
+        for( ulong lo=0; lo<n; lo+=w*2 ){
+             ulong mi = min( lo+w, n ), hi = min( lo+w*2, n ), i=lo, j=mi, k=lo;
+             while( i<mi && j<hi ){ des[k++] = cmp( src[j], src[i] ) ? src[j++] : src[i++]; }
+             while( i<mi ){ des[k++] = src[i++]; }
+             while( j<hi ){ des[k++] = src[j++]; }
+        }    type::swap( src, des ); }
+
+        if( src!=a ){ for( ulong x=0; x<n; ++x ){ a[x] = src[x]; } }
+    }
+
+    template< class T, class F >
+    void stable_sort( T* a, ulong n, F cmp ) {
+        if( n<2 ){ return; } if( cmp( a[0], a[0] ) ){ NODE_STRICT<F> strict {cmp};
+              merge_sort( a, n, strict ); }
+        else{ merge_sort( a, n, cmp ); }
+    }
+
+    /*─······································································─*/
+
+    /* bottom-up merge sort over a singly linked chain ( N::next ), with  *
+     * bin[i] holding a sorted run of 2^i nodes. Stable, no allocation.   */
+
+    template< class N, class F >
+    N* merge_list( N* a, N* b, F& cmp ) {
+        N* head = nullptr; N** tail = &head; while( a!=nullptr && b!=nullptr ){
+        if( cmp( b->data, a->data ) ){ *tail = b; b = b->next; }
+        else /*-------------------*/ { *tail = a; a = a->next; }
+            tail = &(*tail)->next;
+        }   *tail = a!=nullptr ? a : b; return head;
+    }
+
+    template< class N, class F >
+    N* merge_list_sort( N* list, F& cmp ) {
+        N* bin[64]; for( auto& x: bin ){ x = nullptr; }
+
+        while( list!=nullptr ){
+            N* run = list; list = list->next; run->next = nullptr; uint i=0;
+            for( ; i<63 && bin[i]!=nullptr; ++i ){ run = merge_list( bin[i], run, cmp ); bin[i]=nullptr; }
+            bin[i] = bin[i]==nullptr ? run : merge_list( bin[i], run, cmp );
+        }
+
+        N* out = nullptr; for( uint i=0; i<64; ++i ){
+        if( bin[i]!=nullptr ){ out = merge_list( bin[i], out, cmp ); }
+        }   return out;
+    }
+
+    template< class N, class F >
+    N* sort_list( N* list, F cmp ) {
+        if( list==nullptr ){ return list; } if( cmp( list->data, list->data ) ){
+              NODE_STRICT<F> strict {cmp}; return merge_list_sort( list, strict ); }
+        return merge_list_sort( list, cmp );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_ARENA
+#define NODEPP_ARENA
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include <new>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace arena {
+
+    /* bump allocator over ARENA_CHUNK-byte chunks. Blocks are never freed *
+     * one by one: every block and every arena_t handle holds a reference *
+     * and the chunks go back to malloc in one shot when the last of them  *
+     * is gone. Only the thread that has the arena in use() may allocate. *
+     *                                                                     *
+     * Lifetime rule: a container created inside use() keeps drawing from  *
+     * the arena for as long as it lives, and nothing it frees is reused.  *
+     * Anything meant to outlive the scope ( thread_local or static state, *
+     * caches, long-lived connections ) must be built outside of it, or    *
+     * under arena::outside( cb ), or it pins the arena's chunks for good. */
+
+    enum ARENA {
+         ARENA_ALIGN = 16,
+         ARENA_CHUNK = 4096
+    };
+
+    struct NODE_CHUNK { NODE_CHUNK* next; ulong size; };
+
+    struct NODE_ARENA {
+        NODE_CHUNK* head=nullptr; char *pos=nullptr, *end=nullptr;
+        atomic_t<ulong> count; ulong chunk=ARENA_CHUNK, used=0;
+       ~NODE_ARENA() noexcept { while( head!=nullptr ){
+            auto x = head->next; ::free( head ); head = x;
+        }}
+    };
+
+    struct alignas(ARENA_ALIGN) NODE_BLOCK { NODE_ARENA* arena; };
+
+    /*─······································································─*/
+
+    inline NODE_ARENA*& get_current() noexcept {
+        thread_local static NODE_ARENA* current = nullptr; return current;
+    }
+
+    struct NODE_SCOPE { NODE_ARENA* prev;
+        NODE_SCOPE( NODE_ARENA* x ) noexcept : prev( get_current() ) { get_current() = x; }
+       ~NODE_SCOPE() noexcept { get_current() = prev; }
+    };
+
+    inline NODE_ARENA* ref( NODE_ARENA* address ) noexcept {
+        if( address!=nullptr ){ address->count.add(1); } return address;
+    }
+
+    inline void unref( NODE_ARENA* address ) noexcept {
+        if( address!=nullptr && address->count.sub(1)==1 ){ delete address; }
+    }
+
+    /*─······································································─*/
+
+    /* a block whose arena is nullptr came from operator new, because a *
+     * chunk couldn't be had; release() hands it back to operator delete. */
+
+    inline void* alloc_heap( ulong size ) noexcept {
+        auto y = (NODE_BLOCK*) ::operator new( sizeof(NODE_BLOCK) + size );
+        y->arena = nullptr; return y + 1;
+    }
+
+    inline void* alloc( NODE_ARENA* address, ulong size ) noexcept {
+        ulong need = ( sizeof(NODE_BLOCK) + size + ARENA_ALIGN - 1 ) / ARENA_ALIGN * ARENA_ALIGN;
+        ulong head = ( sizeof(NODE_CHUNK) + ARENA_ALIGN - 1 ) / ARENA_ALIGN * ARENA_ALIGN;
+
+        if( address->pos==nullptr || (ulong)( address->end - address->pos ) < need ){
+            ulong len = max( address->chunk, need + head );
+            auto  x   = (NODE_CHUNK*) ::malloc( len ); if( x==nullptr ){ return alloc_heap( size ); }
+            x->size   = len; x->next = address->head; address->head = x;
+        if( need*4 <= address->chunk ){
+            address->pos = (char*) x + head; address->end = (char*) x + len;
+        } else {
+            address->used += need; ref( address );
+            auto y = (NODE_BLOCK*)( (char*) x + head ); y->arena = address; return y + 1;
+        }}
+
+        auto y = (NODE_BLOCK*) address->pos; address->pos += need;
+        address->used += need; ref( address ); y->arena = address; return y + 1;
+    }
+
+    inline void release( void* address ) noexcept {
+        if( address==nullptr ){ return; } auto y = (NODE_BLOCK*) address - 1;
+        if( y->arena==nullptr ){ ::operator delete( (void*) y ); return; } unref( y->arena );
+    }
+
+    /* runs cb with no arena bound, e.g. to build thread_local state the *
+     * first time it is reached from inside an arena_t::use() scope.     */
+
+    template< class T, class... V >
+    auto outside( T cb, const V&... args ) -> decltype( cb( args... ) ) {
+        NODE_SCOPE scope( nullptr ); return cb( args... );
+    }
+
+    /*─······································································─*/
+
+    template< class T, class... V >
+    T* make( NODE_ARENA* address, const V&... args ){
+        return new( alloc( address, sizeof(T) ) ) T( args... );
+    }
+
+    template< class T >
+    void drop( T* address ) noexcept {
+        if( address==nullptr ){ return; } address->~T(); release( address );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class arena_t {
+protected:
+
+    /* an arena_t is bound to a thread for the length of use( cb ): every *
+     * ptr_t and queue_t created inside cb takes its memory from it.      */
+
+    arena::NODE_ARENA* obj;
+
+public:
+
+    arena_t( ulong chunk=arena::ARENA_CHUNK ) noexcept : obj( new arena::NODE_ARENA() ) {
+        obj->count = 1; obj->chunk = max( (ulong) arena::ARENA_ALIGN * 4, chunk );
+    }
+
+    arena_t( const arena_t& other ) noexcept : obj( arena::ref( other.obj ) ) {}
+
+    arena_t& operator=( const arena_t& other ) noexcept {
+        if( obj==other.obj ){ return *this; }
+        arena::unref( obj ); obj = arena::ref( other.obj ); return *this;
+    }
+
+   ~arena_t() noexcept { arena::unref( obj ); }
+
+    /*─······································································─*/
+
+    ulong size() const noexcept { return obj->used; }
+
+    ulong count() const noexcept { return obj->count.get(); }
+
+    /*─······································································─*/
+
+    void* alloc( ulong size ) const noexcept { return arena::alloc( obj, size ); }
+
+    template< class T, class... V >
+    auto use( T cb, const V&... args ) const -> decltype( cb( args... ) ) {
+        arena::NODE_SCOPE scope( obj ); return cb( args... );
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
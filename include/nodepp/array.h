@@ -52,6 +52,29 @@ protected:
         arr[0] = b; arr[1] = a; arr[2] = c; return arr;
     }
 
+    /*─······································································─*/
+
+    /* buffer may hold more slots than the array shows. While nobody else *
+     * shares it, inserts widen the view in place and erases shift inside *
+     * it; a shared buffer is copied first ( to twice the size ) so other *
+     * holders never see the change.                                      */
+
+    bool is_unique() const noexcept { return buffer.count() <= 1; }
+
+    void make_room( ulong index, ulong N ) noexcept {
+        ulong len = size(); if( !is_unique() || len+N > buffer.capacity() )
+          { reserve( max( len+N, len*2 ) ); }
+        buffer.slice( 0, len+N ); auto x = begin();
+        for( ulong y=len; y-->index; ){ x[y+N] = x[y]; }
+    }
+
+    void drop_room( ulong index, ulong N ) noexcept {
+        ulong len = size(); auto x = begin();
+        for( ulong y=index; y+N<len; ++y ){ x[y] = x[y+N]; }
+        for( ulong y=len-N; y<len   ; ++y ){ x[y] = T(); }
+        buffer.slice( 0, len-N );
+    }
+
 public: 
 
     array_t( const ulong& n, const T& c ) noexcept {
@@ -91,13 +114,26 @@ public:
     ulong  size() const noexcept { return empty() ? 0 : buffer.size() - 0; }
     ulong  last() const noexcept { return empty() ? 0 : buffer.size() - 1; }
 
+    ulong capacity() const noexcept { return buffer.capacity(); }
+
+    /*─······································································─*/
+
+    void reserve( ulong n ) noexcept {
+        if( n == 0 || ( is_unique() && n <= buffer.capacity() ) ){ return; }
+        ulong len = size(); auto n_buffer = ptr_t<T>( max( n, len ) );
+        type::copy( begin(), end(), n_buffer.begin() );
+        n_buffer.slice( 0, len ); buffer = n_buffer;
+    }
+
+    void shrink_to_fit() noexcept {
+        if( empty() ) /*----------------*/ { buffer.reset(); return; }
+        if( size() == buffer.capacity() ){ return; } buffer = buffer.copy();
+    }
+
     /*─······································································─*/
 
     array_t operator+=( const array_t& oth ){
-        if( oth.empty() ){ return *this; } /*------------------*/
-        auto slf=copy(); buffer.resize( slf.size() +oth.size() );
-        type::copy( oth.begin(), oth.end(), begin()+slf.size() );
-        type::copy( slf.begin(), slf.end(), begin() ); return *this;
+        insert( size(), oth ); return *this;
     }
 
     /*─······································································─*/
@@ -219,21 +255,17 @@ public:
 
     /*─······································································─*/
 
-    array_t sort( function_t<bool,T,T> func ) const noexcept {
-    queue_t<T> n_buffer; T* addr = begin();
-
-    while( addr != end() ){ auto x = *addr;
-
-        if( n_buffer.empty() ) { n_buffer.push( x ); } else {
-        if( func( x, n_buffer.last()->data ) ) {
-            auto n = n_buffer.last();
-            while( n != nullptr && func( x, n->data ) ) { n= n->prev; }
-            n_buffer.insert( n==nullptr ? n_buffer.first() : n->next, x );
-        } else { n_buffer.push( x ); } }
+    template< class F >
+    array_t sort( F func ) const noexcept {
+        array_t out = copy(); algorithm::sort( out.begin(), out.size(), func ); return out;
+    }
 
-    ++addr; }
+    template< class F >
+    array_t stable_sort( F func ) const noexcept {
+        array_t out = copy(); algorithm::stable_sort( out.begin(), out.size(), func ); return out;
+    }
 
-    return n_buffer.data(); }
+    array_t sort( function_t<bool,T,T> func ) const noexcept { return sort<function_t<bool,T,T>>( func ); }
 
     /*─······································································─*/
 
@@ -251,62 +283,40 @@ public:
     /*─······································································─*/
 
     void insert( ulong index, const T& value ) noexcept {
-	    index = clamp( index, 0UL, size() ); if( empty() ){ buffer = ptr_t<T> (1); buffer[0] = value; }
-        else { ulong n=size() + 1; auto n_buffer = ptr_t<T>( n );
-            type::copy( begin()+index, end()        , n_buffer.begin()+index+1 );
-            type::copy( begin()      , begin()+index, n_buffer.begin()         );
-            n_buffer[index] = value; buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); T item = value;
+        make_room( index, 1 ); begin()[index] = item;
     }
 
     void insert( ulong index, ulong N, const T& value ) noexcept {
-	    index = clamp( index, 0UL, size() ); if( empty() ){ buffer = ptr_t<T> ( N, value ); }
-        else{ ulong n=size() + N; auto n_buffer = ptr_t<T>( n );
-            type::copy( begin()+index         , end()                   , n_buffer.begin()+index+N );
-            type::fill( n_buffer.begin()+index, n_buffer.begin()+index+N, value                    );
-            type::copy( begin()               , begin()+index           , n_buffer.begin()         );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N==0 ){ return; } T item = value;
+        make_room( index, N ); type::fill( begin()+index, begin()+index+N, item );
     }
 
     void insert( ulong index, const array_t& value ) noexcept {
-	    index = clamp( index, 0UL, size() ); if( empty() ){ buffer = ptr_t<T> ( value.size() );
-            type::copy( value.begin(), value.end(), buffer.begin() );
-        } else { auto n_buffer = ptr_t<T>( size() + value.size() );
-                 ulong N=value.size();
-            type::copy( begin()+index, end()        , n_buffer.begin()+index+N );
-            type::copy( value.begin(), value.end()  , n_buffer.begin()+index   );
-            type::copy( begin()      , begin()+index, n_buffer.begin()         );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( value.empty() ){ return; } 
+        array_t item = value; /*keeps a self-insert source alive*/ 
+        make_room( index, item.size() ); 
+        type::copy( item.begin(), item.end(), begin()+index );
     }
 
     void insert( ulong index, ulong N, T* value ) noexcept {
 	    index = clamp( index, 0UL, size() ); if( empty() ){ buffer = ptr_t<T> ( value, N ); }
-        else { ulong n=size() + N; auto n_buffer = ptr_t<T>( n );
-            type::copy( begin()+index, end()        , n_buffer.begin()+index+N );
-            type::copy( value        , value+N      , n_buffer.begin()+index   );
-            type::copy( begin()      , begin()+index, n_buffer.begin()         );
-            buffer = n_buffer;
+        else { ptr_t<T> keep; if( value>=begin() && value<end() ){ keep = buffer; }
+            make_room( index, N ); type::copy( value, value+N, begin()+index );
         }
     }
 
     template< class V, ulong N >
     void insert( ulong index, const V (&value)[N] ) noexcept {
-	    index = clamp( index, 0UL, size() ); if( empty() ){ buffer = ptr_t<T> ( N ); 
-            type::copy( value, value + N, buffer.begin() );
-        } else { ulong n=size() + N; auto n_buffer = ptr_t<T>( n );
-            type::copy( begin()+index, end()        , n_buffer.begin()+index+N );
-            type::copy( value        , value + N    , n_buffer.begin()+index   );
-            type::copy( begin()      , begin()+index, n_buffer.begin()         );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() );
+        make_room( index, N ); type::copy( value, value + N, begin()+index );
     }
 
     /*─······································································─*/
 
     void erase( ulong index ) noexcept {
 	    auto r = get_slice_range( index, size() ); if ( r.null() ){ return; }
+        elif ( is_unique() ){ drop_room( r[0], 1 ); }
         else { auto n_buffer = ptr_t<T>( size() - 1 );
             type::copy( begin()+r[0]+1, end()       , n_buffer.begin()+r[0] );
             type::copy( begin()       , begin()+r[0], n_buffer.begin()      );
@@ -316,6 +326,7 @@ public:
 
     void erase( ulong start, ulong stop ) noexcept {
 	    auto r = get_slice_range( start, stop ); if ( r.null() ){ return; }
+        elif ( is_unique() ){ drop_room( r[0], r[2] ); }
         else { auto n_buffer = ptr_t<T>( size()-r[2] );
             type::copy( begin()+r[1]+1, end()       , n_buffer.begin()+r[0] );
             type::copy( begin()       , begin()+r[0], n_buffer.begin()      );
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_CHAIN
+#define NODEPP_CHAIN
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class buffer_chain_t {
+public:
+
+    /* an ordered list of string_t slices written out with one gather call *
+     * ( writev / sendmsg / WSASend ). Slices are shared, never copied: a  *
+     * partial write just narrows the first one with slice_view().         */
+
+    enum CHAIN { CHAIN_IOV = 64 };
+
+protected:
+
+    struct NODE {
+        queue_t<string_t> queue; ulong size=0;
+    };  ptr_t<NODE> obj;
+
+public:
+
+    buffer_chain_t( const string_t& msg ) noexcept : obj( ptr::make<NODE>() ) { push( msg ); }
+
+    buffer_chain_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+    /*─······································································─*/
+
+    queue_t<string_t>& get_queue() const noexcept { return obj->queue; }
+
+    string_t& first() const noexcept { return obj->queue.first()->data; }
+
+    ulong count() const noexcept { return obj->queue.size(); }
+
+    ulong size() const noexcept { return obj->size; }
+
+    bool empty() const noexcept { return obj->size==0; }
+
+    /*─······································································─*/
+
+    void push( const string_t& msg ) const noexcept {
+        if( msg.empty() ){ return; } obj->queue.push( msg ); obj->size += msg.size();
+    }
+
+    void unshift( const string_t& msg ) const noexcept {
+        if( msg.empty() ){ return; } obj->queue.unshift( msg ); obj->size += msg.size();
+    }
+
+    void clear() const noexcept { obj->queue.clear(); obj->size=0; }
+
+    /*─······································································─*/
+
+    void consume( ulong size ) const noexcept {
+        while( size>0 && !empty() ){ auto& x = first();
+        if   ( x.size()<=size ){ size -= x.size(); obj->size -= x.size(); obj->queue.shift(); }
+        else { x = x.slice_view( size, x.size() ); obj->size -= size; size = 0; }
+    }}
+
+    string_t read( ulong size ) const noexcept {
+        string_t out = slice( size ); consume( out.size() ); return out;
+    }
+
+    /*─······································································─*/
+
+    string_t slice( ulong size ) const noexcept {
+        size = min( size, obj->size ); if( size==0 ){ return nullptr; }
+        if( first().size()>=size ){ return first().slice_view( 0, size ); }
+
+        string_t out ( size, '\0' ); ulong pos=0; auto x = obj->queue.first();
+        while( x!=nullptr && pos<size ){ ulong len = min( x->data.size(), size-pos );
+            memcpy( out.get()+pos, x->data.get(), len ); pos += len; x = x->next;
+        }   return out;
+    }
+
+    string_t join() const noexcept { return slice( obj->size ); }
+
+    buffer_chain_t copy() const noexcept { buffer_chain_t out;
+        auto x = obj->queue.first(); while( x!=nullptr ){
+            out.push( x->data ); x = x->next;
+        }   return out;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -24,13 +24,13 @@ namespace nodepp { template< class T > class channel_t: public generator_t {
 private:
 
     struct NODE { 
-        /*--------*/ queue_t<T> queue; 
+        /*--------*/ ring_t<T> queue; 
         ulong limit; mutex_t mut; 
     };  ptr_t<NODE> obj;
 
 public:
 
-    channel_t( ulong limit=0 ) noexcept : obj( new NODE() ){ obj->limit=limit; }
+    channel_t( ulong limit=0 ) noexcept : obj( ptr::make<NODE>() ){ obj->limit=limit; }
 
     /*─······································································─*/
 
@@ -49,7 +49,7 @@ public:
     int _read( ptr_t<T>& out ) const noexcept { 
     return obj->mut._emit([&](){ 
         if( obj->queue.empty() ){ return -2; }
-        out=obj->queue.first()->data; obj->queue.shift();
+        out=obj->queue.first(); obj->queue.shift();
     return 1; }); }
 
     int _write( const T& msg ) const noexcept { 
@@ -63,7 +63,7 @@ public:
     ptr_t<T> read() const noexcept { 
     ptr_t<T> out; int c=0; while((c=obj->mut.emit([&](){
         if( obj->queue.empty() ){ return -2; }
-        out=obj->queue.first()->data; obj->queue.shift();
+        out=obj->queue.first(); obj->queue.shift();
     return 1; }))==-2 ){ process::next(); } return c>0 ? out : nullptr ; }
 
     int write( const T& msg ) const noexcept { 
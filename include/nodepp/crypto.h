@@ -68,7 +68,7 @@ protected:
 public:
 
     template< class T >
-    hash_t( const T& type, ulong length ) : obj( new NODE() ) { 
+    hash_t( const T& type, ulong length ) : obj( ptr::make<NODE>() ) { 
          
         obj->bff   = ptr_t<uchar>( length );
         obj->ctx   = EVP_MD_CTX_new();
@@ -127,7 +127,7 @@ public:
 
     template< class T >
     hmac_t( const string_t& key, const T& type, ulong length ) 
-    :  obj( new NODE() ) { if( key.empty() ){ return; }
+    :  obj( ptr::make<NODE>() ) { if( key.empty() ){ return; }
         obj->bff   = ptr_t<uchar>( length ); 
         obj->ctx   = HMAC_CTX_new(); 
         obj->state = 1;
@@ -186,7 +186,7 @@ public:
     event_t<>         onClose;
     event_t<string_t> onData;
 
-    xor_t( const string_t& key ) noexcept: obj( new NODE() ) {
+    xor_t( const string_t& key ) noexcept: obj( ptr::make<NODE>() ) {
         if( key.empty() ){ return; } obj->state = 1;
 
         CTX item1; //memset( &item1, 0, sizeof(CTX) );
@@ -195,7 +195,7 @@ public:
         obj->ctx = ptr_t<CTX> ({ item1 });
     }
 
-    xor_t() noexcept : obj( new NODE() ) { obj->state = 0; }
+    xor_t() noexcept : obj( ptr::make<NODE>() ) { obj->state = 0; }
     
    ~xor_t() noexcept { if( obj.count()>1 ){ return; } free(); }
 
@@ -246,7 +246,7 @@ public:
 
     template< class T >
     encrypt_t( const string_t& key, const T& type )
-    :   obj( new NODE() ) { if( key.empty() ){ return; }
+    :   obj( ptr::make<NODE>() ) { if( key.empty() ){ return; }
         uchar iv[EVP_MAX_IV_LENGTH] = {0};
         obj->bff = ptr_t<uchar>(CHUNK_SIZE,'\0');
         obj->ctx = EVP_CIPHER_CTX_new(); obj->state = 1;
@@ -256,7 +256,7 @@ public:
 
     template< class T >
     encrypt_t( const string_t& iv, const string_t& key, const T& type )
-    :   obj( new NODE() ) { if( key.empty() || iv.empty() ){ return; }
+    :   obj( ptr::make<NODE>() ) { if( key.empty() || iv.empty() ){ return; }
         obj->bff = ptr_t<uchar>(CHUNK_SIZE,'\0');
         obj->ctx = EVP_CIPHER_CTX_new(); obj->state = 1;
         if ( !obj->ctx || !EVP_EncryptInit_ex( obj->ctx, type, NULL, (uchar*)key.data(), (uchar*)iv.data() ) )
@@ -317,7 +317,7 @@ public:
 
     template< class T >
     decrypt_t( const string_t& key, const T& type )
-    :   obj( new NODE() ) { if( key.empty() ){ return; }
+    :   obj( ptr::make<NODE>() ) { if( key.empty() ){ return; }
         uchar iv[EVP_MAX_IV_LENGTH] = {0};
         obj->bff = ptr_t<uchar>(CHUNK_SIZE,'\0');
         obj->ctx = EVP_CIPHER_CTX_new(); obj->state = 1;
@@ -327,7 +327,7 @@ public:
 
     template< class T >
     decrypt_t( const string_t& iv, const string_t& key, const T& type )
-    :   obj( new NODE() ) { if( key.empty() || iv.empty() ){ return; }
+    :   obj( ptr::make<NODE>() ) { if( key.empty() || iv.empty() ){ return; }
         obj->bff = ptr_t<uchar>(CHUNK_SIZE,'\0');
         obj->ctx = EVP_CIPHER_CTX_new(); obj->state = 1;
         if ( !obj->ctx || !EVP_DecryptInit_ex( obj->ctx, type, NULL, (uchar*)key.data(), (uchar*)iv.data() ) )
@@ -403,7 +403,7 @@ public:
     event_t<string_t> onData;
     event_t<>         onClose;
 
-    encoder_t( const string_t& chr ) : obj( new NODE() ) { 
+    encoder_t( const string_t& chr ) : obj( ptr::make<NODE>() ) { 
         obj->state = 1; obj->chr = chr; obj->bn = (BIGNUM*) BN_new();
         if( !obj->bn ){ throw except_t("can't initializate encoder"); }
     }
@@ -474,7 +474,7 @@ public:
     event_t<string_t> onData;
     event_t<>         onClose;
 
-    decoder_t( const string_t& chr ) : obj( new NODE() ) { 
+    decoder_t( const string_t& chr ) : obj( ptr::make<NODE>() ) { 
         obj->state = 1; obj->chr = chr; obj->bn = (BIGNUM*) BN_new();
         if( !obj->bn ){ throw except_t("can't initializate decoder"); }
     }
@@ -529,7 +529,7 @@ public:
 
    ~base64_encoder_t() noexcept { if( obj.count()>1 ){ return; } free(); }
 
-    base64_encoder_t() noexcept : obj( new NODE() ) {
+    base64_encoder_t() noexcept : obj( ptr::make<NODE>() ) {
         obj->state = 1; obj->bff = ptr_t<char>( CHUNK_SIZE, '\0' );
 
         CTX item1; memset( &item1, 0, sizeof(CTX) );
@@ -610,7 +610,7 @@ public:
 
    ~base64_decoder_t() noexcept { if( obj.count()>1 ){ return; } free(); }
 
-    base64_decoder_t() noexcept : obj( new NODE() ) {
+    base64_decoder_t() noexcept : obj( ptr::make<NODE>() ) {
         obj->state = 1; obj->bff = ptr_t<char>( CHUNK_SIZE, '\0' );
 
         CTX item1; memset( &item1, 0, sizeof(CTX) );
@@ -682,7 +682,7 @@ protected:
 
 public:
 
-    X509_t( uint rsa_size=2048 ) : obj( new NODE() ) {
+    X509_t( uint rsa_size=2048 ) : obj( ptr::make<NODE>() ) {
         
         obj->ctx = X509_new(); obj->name= X509_NAME_new();  
         obj->rsa = RSA_new();  obj->num = BN_new();
@@ -779,7 +779,7 @@ protected:
     
 public:
 
-    rsa_t() : obj( new NODE() ) {
+    rsa_t() : obj( ptr::make<NODE>() ) {
         obj->rsa = RSA_new(); obj->num = BN_new (); obj->state = 1;
         if( !obj->num || !obj->rsa ){ throw except_t("creating rsa object"); }
     }
@@ -916,7 +916,7 @@ protected:
 public:
 
     template< class T >
-    ec_t( const string_t& key, const T& type ) noexcept :obj( new NODE() ) {
+    ec_t( const string_t& key, const T& type ) noexcept :obj( ptr::make<NODE>() ) {
         
         if( key.empty() ){ return; }
         obj->state = 1;
@@ -934,7 +934,7 @@ public:
     }
 
     template< class T >
-    ec_t( const T& type ) noexcept : obj( new NODE() ) { 
+    ec_t( const T& type ) noexcept : obj( ptr::make<NODE>() ) { 
         obj->state = 1;
 
         obj->key_pair  = EC_KEY_new();
@@ -989,7 +989,7 @@ protected:
 
 public:
 
-    dh_t() : obj( new NODE() ) {
+    dh_t() : obj( ptr::make<NODE>() ) {
         obj->dh = DH_new(); obj->k = BN_new(); obj->state = 1;
         if( !obj->dh || !obj->k ){ throw except_t( "creating new dh" ); }
     }
@@ -1064,7 +1064,7 @@ protected:
     
 public:
 
-    dsa_t(): obj( new NODE() ) { obj->state = 1; obj->dsa = DSA_new(); }
+    dsa_t(): obj( ptr::make<NODE>() ) { obj->state = 1; obj->dsa = DSA_new(); }
 
    ~dsa_t() noexcept { if( obj.count() > 1 ){ return; } free(); }
 
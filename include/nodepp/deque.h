@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_DEQUE
+#define NODEPP_DEQUE
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class T > class deque_t {
+private:
+
+    /* Chase-Lev work-stealing deque: one owner thread pushes and pops at  *
+     * the bottom, any thread may steal from the top. The ring has a fixed *
+     * capacity; push() fails instead of growing, so no buffer is ever     *
+     * freed while a thief may still be reading it.                        */
+
+    enum DEQUE { DEQUE_PAD = 64 };
+
+protected:
+
+    struct NODE {
+        ptr_t<atomic_t<T>> buffer; ulong mask=0;
+        char pad1[DEQUE_PAD]; atomic_t<long> top;
+        char pad2[DEQUE_PAD]; atomic_t<long> bottom;
+        char pad3[DEQUE_PAD];
+    };  ptr_t<NODE> obj;
+
+public:
+
+    deque_t( ulong size=1024 ) noexcept : obj( ptr::make<NODE>() ) {
+        ulong cap = 2; while( cap < size ){ cap <<= 1; }
+        obj->buffer.resize( cap ); obj->mask = cap - 1;
+    }
+
+    /*─······································································─*/
+
+    ulong size() const noexcept {
+        long b = obj->bottom.get(), t = obj->top.get();
+        return b > t ? b - t : 0;
+    }
+
+    ulong capacity() const noexcept { return obj->mask + 1; }
+
+    bool empty() const noexcept { return size()==0; }
+
+    /*─······································································─*/
+
+    bool push( const T& value ) const noexcept {
+        long b = obj->bottom.get(), t = obj->top.get();
+        if( b - t > (long) obj->mask ){ return false; }
+        obj->buffer[ b & obj->mask ].set( value );
+        obj->bottom.set( b+1 ); return true;
+    }
+
+    bool pop( T& out ) const noexcept {
+        long b = obj->bottom.get() - 1; obj->bottom.swap( b );
+        long t = obj->top   .get();
+
+        if( t > b ){ obj->bottom.set( b+1 ); return false; }
+        out = obj->buffer[ b & obj->mask ].get(); if( t < b ){ return true; }
+
+        bool done = obj->top.compare( t, t+1 );
+        obj->bottom.set( b+1 ); return done;
+    }
+
+    bool steal( T& out ) const noexcept {
+        long t = obj->top   .get();
+        long b = obj->bottom.add(0); if( t >= b ){ return false; }
+        T    x = obj->buffer[ t & obj->mask ].get();
+        if( !obj->top.compare( t, t+1 ) ){ return false; }
+        out  = x; return true;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
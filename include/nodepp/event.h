@@ -33,7 +33,7 @@ protected:
 
 public:
 
-    event_t() noexcept : obj( new NODE() ) {}
+    event_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
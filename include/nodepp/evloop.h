@@ -52,6 +52,20 @@ namespace nodepp { namespace process {
 
     /*─······································································─*/
 
+    inline void set_budget( ulong task, ulong time=0 ){ NODEPP_EV_LOOP().set_budget( task, time ); }
+    inline task_budget_t get_budget() /**/ { return NODEPP_EV_LOOP().get_budget(); }
+
+    inline void set_busy_poll( ulong time ){ NODEPP_EV_LOOP().set_busy_poll( time ); }
+    inline busy_poll_t get_busy_poll() /**/ { return NODEPP_EV_LOOP().get_busy_poll(); }
+
+    /*─······································································─*/
+
+    inline loop_stats_t stats(){ auto out = NODEPP_EV_LOOP().get_stats();
+        out.elapsed = out.stamp==0 ? 0 : process::millis() - out.stamp; 
+    return out; }
+
+    /*─······································································─*/
+
     inline int next(){ return NODEPP_EV_LOOP().next(); }
 
     inline void exit( int err=0 ){ 
@@ -63,6 +77,51 @@ namespace nodepp { namespace process {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { class loop_handle_t {
+protected:
+
+    /* a handle to the loop of the thread that created it. post() may be  *
+     * called from any thread; the callback runs on the owning loop. It   *
+     * shares only that loop's post_box_t, never the kernel itself. Like  *
+     * a running worker_t, a live handle keeps that loop from exiting;    *
+     * once the loop is gone, post() and emit() return -1.                */
+
+    struct NODE { post_box_t post;
+        NODE( const post_box_t& box ) noexcept : post( box ) { post.attach(); }
+       ~NODE() noexcept { post.detach(); }
+    };  ptr_t<NODE> obj;
+
+public:
+
+    loop_handle_t() noexcept : obj( new NODE( process::NODEPP_EV_LOOP().get_post() ) ) {}
+
+    /*─······································································─*/
+
+    template< class T, class... V >
+    int post( T cb, const V&... args ) const noexcept {
+        if( is_closed() ){ return -1; } return obj->post.post( cb, args... );
+    }
+
+    int emit() const noexcept { return is_closed() ? -1 : obj->post.emit(); }
+
+    /*─······································································─*/
+
+    bool is_closed() const noexcept { return obj.null(); }
+
+    void free() noexcept { obj.reset(); }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    inline loop_handle_t handle(){ return loop_handle_t(); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 #endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
\ No newline at end of file
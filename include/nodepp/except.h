@@ -28,12 +28,12 @@ public:
    	    process::onSIGERROR.off( obj->ev );
     }
 
-    except_t() noexcept : obj( new NODE() ) {}
+    except_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
     template< class T, class = typename type::enable_if<type::is_class<T>::value,T>::type >
-    except_t( const T& except_type ) noexcept : obj( new NODE() ) {
+    except_t( const T& except_type ) noexcept : obj( ptr::make<NODE>() ) {
         obj->msg = except_type.what(); auto inp = type::bind( this );
         obj->ev  = process::onSIGERROR.once([=](int){ inp->print(); });
     }
@@ -41,14 +41,14 @@ public:
     /*─······································································─*/
 
     template< class... T >
-    except_t( const T&... msg ) noexcept : obj( new NODE() ) {
+    except_t( const T&... msg ) noexcept : obj( ptr::make<NODE>() ) {
         obj->msg = string::join( " ", msg... ); auto inp = type::bind( this );
         obj->ev  = process::onSIGERROR.once([=](int){ inp->print(); });
     }
 
     /*─······································································─*/
 
-    except_t( const string_t& msg ) noexcept : obj( new NODE() ) {
+    except_t( const string_t& msg ) noexcept : obj( ptr::make<NODE>() ) {
         obj->msg = msg; auto inp = type::bind( this );
         obj->ev  = process::onSIGERROR.once([=](int){ inp->print(); });
     }
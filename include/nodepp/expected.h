@@ -22,9 +22,9 @@ protected:
 
 public:
 
-    expected_t( const T& val ) noexcept : obj( new NODE() ) { obj->has = true ; obj->data = val; }
+    expected_t( const T& val ) noexcept : obj( ptr::make<NODE>() ) { obj->has = true ; obj->data = val; }
 
-    expected_t( const E& err ) noexcept : obj( new NODE() ) { obj->has = false; obj->data = err; }
+    expected_t( const E& err ) noexcept : obj( ptr::make<NODE>() ) { obj->has = false; obj->data = err; }
 
     /*─······································································─*/
 
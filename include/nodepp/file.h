@@ -18,12 +18,14 @@
     #include "os.h"
     #include "limit.h"
     #include "event.h"
+    #include "chain.h"
     #include "generator.h"
     #include "windows/file.h"
 #elif _KERNEL_ == NODEPP_KERNEL_POSIX
     #include "os.h"
     #include "limit.h"
     #include "event.h"
+    #include "chain.h"
     #include "generator.h"
     #include "posix/file.h"
 #else
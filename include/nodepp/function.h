@@ -14,60 +14,225 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-namespace nodepp { template< class V, class... T > class function_t {
-public:
-    
-    template< class F >
-    function_t( F f ) : func_ptr( new func_impl<F>(f) ) {}
+namespace nodepp { namespace function {
 
-    function_t( null_t ) noexcept : func_ptr(nullptr) {}
-   
-    function_t() noexcept : func_ptr(nullptr) {}
-    
-    /*─······································································─*/
+    /* a callable of up to FUNC_SIZE bytes ( function pointers, lambdas   *
+     * capturing a few ptr_t ) is stored inline, anything bigger behind a *
+     * ptr_t. Either way a call is one jump through a static NODE_VTABLE. */
+
+    enum FUNC {
+         FUNC_SIZE  = 48,
+         FUNC_ALIGN = 16
+    };
+
+    template< class V, class... T > struct NODE_VTABLE {
+        V     (*invoke)( const void*, const T&... );
+        void  (*copy)  ( void*, const void* );
+        void  (*move)  ( void*, void* );
+        void  (*drop)  ( void* );
+        void  (*free)  ( void* );
+        ulong (*count) ( const void* );
+    };
 
-    bool has_value() const noexcept { return func_ptr.has_value(); }
-    ulong    count() const noexcept { return func_ptr.count(); }
-    bool     empty() const noexcept { return func_ptr.null (); }
-    bool      null() const noexcept { return func_ptr.null (); }
-    void      free() const noexcept { /*--*/ func_ptr.free (); }
-    
     /*─······································································─*/
 
-    explicit operator bool(void)    const noexcept { return func_ptr.null(); }
-    
-    V operator()( const T&... arg ) const /*----*/ { return emit( arg... );  }
-    
-    V emit( const T&... arg ) const { 
-        if( !has_value() ){ return V(); }
-        return func_ptr->invoke( arg... ); 
-    }
-    
-private:
+    template< class S > struct NODE_COPY {
+        static void copy( void* des, const void* src ){ new( des ) S( *(const S*) src ); }
+    };
+
+    struct NODE_MOVE {
+        static void copy( void* /*unused*/, const void* /*unused*/ ){}
+    };
+
+    /* S is either F itself or ptr_t<F>. The heap case keeps the old      *
+     * function_t sharing: copies hold the same F, and free() drops it    *
+     * for all of them.                                                   */
+
+    template< class F, class S, bool C, class V, class... T > struct NODE_CALL {
+
+        static V call( const F& f, const T&... arg ){ return f( arg... ); }
+        static V call( const ptr_t<F>& f, const T&... arg ){
+            if( f.null() ){ return V(); } return (*f)( arg... );
+        }
+
+        static void release( F& /*unused*/ ) noexcept {}
+        static void release( ptr_t<F>& f ) noexcept { f.free(); }
+
+        static ulong size( const F& /*unused*/ ) noexcept { return 1; }
+        static ulong size( const ptr_t<F>& f ) noexcept { return f.count(); }
+
+        /*─··································································─*/
+
+        static V invoke( const void* f, const T&... arg ){ return call( *(const S*) f, arg... ); }
+
+        static void move( void* des, void* src ){
+            new( des ) S( type::move( *(S*) src ) ); ((S*) src)->~S();
+        }
+
+        static void  drop ( void* f ) /*----*/ { ((S*) f)->~S(); }
+        static void  free ( void* f ) /*----*/ { release( *(S*) f ); drop( f ); }
+        static ulong count( const void* f ) { return size( *(const S*) f ); }
+
+        using COPY = typename type::conditional< C, NODE_COPY<S>, NODE_MOVE >::type;
+        static const NODE_VTABLE<V,T...> table;
 
-    class func_base { public:
-        virtual ~func_base() { /*-----------------*/ }
-        virtual V invoke( const T&... arg ) const = 0;
     };
-    
+
+    template< class F, class S, bool C, class V, class... T >
+    const NODE_VTABLE<V,T...> NODE_CALL<F,S,C,V,T...>::table = {
+        &NODE_CALL::invoke, &NODE_CALL::COPY::copy, &NODE_CALL::move,
+        &NODE_CALL::drop  , &NODE_CALL::free      , &NODE_CALL::count
+    };
+
     /*─······································································─*/
-    
-    template< class F >
-    class func_impl : public func_base {
+
+    template< bool C, class V, class... T > class NODE_FUNC {
+    protected:
+
+        using VTABLE = NODE_VTABLE<V,T...>;
+
+        alignas(FUNC_ALIGN) mutable char buff[FUNC_SIZE];
+        mutable const VTABLE* vt = nullptr;
+
+        template< class F > struct INLINE {
+            static constexpr bool value = sizeof(F) <= FUNC_SIZE && alignof(F) <= FUNC_ALIGN;
+        };
+
+        template< class F > static bool is_null( const F& /*unused*/ ) noexcept { return false; }
+        template< class R, class... A > static bool is_null( R(*f)(A...) ) noexcept { return f==nullptr; }
+
+        /*─··································································─*/
+
+        template< class F > static ptr_t<F> heap( F& f, type::true_type  ){ return ptr::make<F>( f ); }
+        template< class F > static ptr_t<F> heap( F& f, type::false_type ){ return new F( type::move(f) ); }
+
+        template< class F > void set( F& f, type::true_type ) {
+            new( buff ) F( type::move(f) ); vt = &NODE_CALL<F,F,C,V,T...>::table;
+        }
+
+        template< class F > void set( F& f, type::false_type ) {
+            using COPY = typename type::conditional< C, type::true_type, type::false_type >::type;
+            new( buff ) ptr_t<F>( heap( f, COPY() ) ); vt = &NODE_CALL<F,ptr_t<F>,C,V,T...>::table;
+        }
+
+        template< class F > void set( F& f ) {
+            using FIT = typename type::conditional< INLINE<F>::value, type::true_type, type::false_type >::type;
+            if( !is_null( f ) ){ set( f, FIT() ); }
+        }
+
+        void copy_from( const NODE_FUNC& other ) {
+            if( other.vt==nullptr ){ return; } other.vt->copy( buff, other.buff ); vt = other.vt;
+        }
+
+        void move_from( NODE_FUNC& other ) {
+            if( other.vt==nullptr ){ return; } other.vt->move( buff, other.buff );
+            vt = other.vt; other.vt = nullptr;
+        }
+
+        void reset() const noexcept {
+            if( vt==nullptr ){ return; } auto tmp = vt; vt = nullptr; tmp->drop( buff );
+        }
 
     public:
 
-        func_impl( const F& f ) : func(f) { /*------------------------*/ }
-        virtual V invoke( const T&... arg ) const { return func(arg...); }
+        NODE_FUNC() noexcept {}
+
+       ~NODE_FUNC() noexcept { reset(); }
+
+        /*─··································································─*/
+
+        bool has_value() const noexcept { return vt!=nullptr && vt->count( buff )!=0; }
+        ulong    count() const noexcept { return vt==nullptr ? 0 : vt->count( buff ); }
+        bool     empty() const noexcept { return !has_value(); }
+        bool      null() const noexcept { return !has_value(); }
+
+        void free() const noexcept {
+            if( vt==nullptr ){ return; } auto tmp = vt; vt = nullptr; tmp->free( buff );
+        }
+
+        /*─··································································─*/
+
+        explicit operator bool(void)    const noexcept { return null(); }
+
+        V operator()( const T&... arg ) const /*----*/ { return emit( arg... );  }
+
+        V emit( const T&... arg ) const {
+            if( vt==nullptr ){ return V(); }
+            return vt->invoke( buff, arg... );
+        }
 
-    private:
-        F func;
     };
-    
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class V, class... T >
+class function_t : public function::NODE_FUNC< true, V, T... > {
+protected:
+
+    using NODE = function::NODE_FUNC< true, V, T... >;
+
+public:
+
+    template< class F >
+    function_t( F f ) { NODE::set( f ); }
+
+    function_t( const function_t& other ) { NODE::copy_from( other ); }
+
+    function_t( function_t&& other ) { NODE::move_from( other ); }
+
+    function_t( null_t ) noexcept {}
+
+    function_t() noexcept {}
+
+    /*─······································································─*/
+
+    function_t& operator=( const function_t& other ) {
+        if( this==&other ){ return *this; } function_t tmp( other );
+        NODE::reset(); NODE::move_from( tmp ); return *this;
+    }
+
+    function_t& operator=( function_t&& other ) {
+        if( this==&other ){ return *this; } function_t tmp( type::move(other) );
+        NODE::reset(); NODE::move_from( tmp ); return *this;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class V, class... T >
+class unique_function_t : public function::NODE_FUNC< false, V, T... > {
+protected:
+
+    /* move-only: accepts callables that can't be copied, and is never     *
+     * shared, so a callable too big to sit inline is owned outright.      */
+
+    using NODE = function::NODE_FUNC< false, V, T... >;
+
+public:
+
+    template< class F >
+    unique_function_t( F f ) { NODE::set( f ); }
+
+    unique_function_t( unique_function_t&& other ) { NODE::move_from( other ); }
+
+    unique_function_t( const unique_function_t& ) = delete;
+
+    unique_function_t( null_t ) noexcept {}
+
+    unique_function_t() noexcept {}
+
     /*─······································································─*/
-    
-    ptr_t<func_base> func_ptr;
-    
+
+    unique_function_t& operator=( const unique_function_t& ) = delete;
+
+    unique_function_t& operator=( unique_function_t&& other ) {
+        if( this==&other ){ return *this; } unique_function_t tmp( type::move(other) );
+        NODE::reset(); NODE::move_from( tmp ); return *this;
+    }
+
 };}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -19,6 +19,17 @@ namespace nodepp { namespace generator { namespace file {
 
     GENERATOR( read ){
     protected: ulong d; ulong* r;
+
+    /* a read that fills half the stream buffer or more hands the buffer *
+     * itself to data and the stream gets a fresh one, so onData sees    *
+     * the bytes recv() wrote instead of a copy of them.                 */
+
+    template< class T > string_t take( T* str, ulong size ) const noexcept {
+        auto& buf = str->get_buffer(); if( size*2<buf.size() || size>=buf.size() || buf.count()>1 )
+          { return string_t( buf.data(), size ); } buf[size] = '\0';
+        string_t out( buf, 0, size+1 ); buf = ptr_t<char>( buf.size() ); return out;
+    }
+
     public:    string_t data; int state;
 
     template< class T > coEmit( T* str, ulong size=CHUNK_SIZE ){
@@ -31,10 +42,10 @@ namespace nodepp { namespace generator { namespace file {
         if( pos < r[0] ){ str->del_borrow(); str->pos(r[0]); }
       elif( pos >=r[1] ){ coEnd; } } else { d = str->get_buffer_size(); }
 
-        if( data.empty() ){ 
-            coWait((state=str->_read(str->get_buffer_data(),min(d,size)))==-2);
+        if( data.empty() ){ d = min( min( d, size ), max( 1UL, str->get_buffer_size()-1 ) );
+            coWait((state=str->_read(str->get_buffer_data(),d))==-2);
         if( state<=0 ){ coEnd; }
-        if( state >0 ){ data=string_t(str->get_buffer_data(),(ulong)state); }}
+        if( state >0 ){ data=take( str, (ulong)state ); }}
 
         state = min( data.size(), size ); /*---------------*/
         str->set_borrow( data.splice( state, data.size() ) );
@@ -59,6 +70,24 @@ namespace nodepp { namespace generator { namespace file {
 
     /*─······································································─*/
 
+    GENERATOR( writev ){
+    public: ulong data; int state; buffer_chain_t chain;
+
+    template< class T > coEmit( T* str, const buffer_chain_t& msg ){
+    coBegin state=0; data=0; chain=msg.copy();
+
+        if(!str->is_available() || chain.empty() ){ coEnd; }
+
+        do{ coWait((state=str->_writev( chain ))==-2 );
+        if( state<=0 ){ coEnd; }
+        if( state >0 ){ data += state; chain.consume( state ); }} while ( state>=0 && !chain.empty() );
+
+        chain.clear();
+
+    coFinish }};
+
+    /*─······································································─*/
+
     GENERATOR( until ){
     protected: ulong pos; file::read _read;
     public: int state; string_t data;
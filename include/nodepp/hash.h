@@ -0,0 +1,140 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_HASH
+#define NODEPP_HASH
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include <ctime>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace hash {
+
+    /* wyhash ( final v4 ) keyed with a per-process seed, so keys picked *
+     * from outside can't be aimed at a single probe chain of a map_t.   */
+
+    enum HASH : ullong {
+         HASH_P0 = 0xa0761d6478bd642fULL,
+         HASH_P1 = 0xe7037ed1a0b428dbULL,
+         HASH_P2 = 0x8ebc6af09c88c6e3ULL,
+         HASH_P3 = 0x589965cc75374cc3ULL
+    };
+
+    inline void mul( ullong& a, ullong& b ) noexcept {
+    #ifdef __SIZEOF_INT128__
+        __uint128_t r = (__uint128_t) a * b; a = (ullong) r; b = (ullong)( r >> 64 );
+    #else
+        ullong ha = a >> 32, hb = b >> 32, la = (uint) a, lb = (uint) b;
+        ullong rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        ullong t  = rl + ( rm0 << 32 ), c = t < rl;
+        ullong lo = t  + ( rm1 << 32 ); c += lo < t;
+        a = lo; b = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+    #endif
+    }
+
+    inline ullong mix( ullong a, ullong b ) noexcept { mul( a, b ); return a ^ b; }
+
+    /*─······································································─*/
+
+    inline ullong get_seed() noexcept {
+        static const ullong seed = mix( (ullong) ::time( nullptr ) ^ HASH_P2,
+                                        (ullong) (size_t) &get_seed ^ (ullong) ::clock() ^ HASH_P3 );
+        return seed;
+    }
+
+    inline ullong read_8( const uchar* p ) noexcept { ullong v; memcpy( &v, p, 8 ); return v; }
+    inline ullong read_4( const uchar* p ) noexcept { uint   v; memcpy( &v, p, 4 ); return v; }
+
+    /*─······································································─*/
+
+    inline ulong get( const void* data, ulong size ) noexcept {
+        const uchar* p = (const uchar*) data; ullong a=0, b=0, len=size;
+        ullong seed = get_seed(); seed ^= mix( seed ^ HASH_P0, HASH_P1 );
+
+        if( len<=16 ){
+        if  ( len>=4 ){
+            a = ( read_4( p ) << 32 ) | read_4( p + ( ( len >> 3 ) << 2 ) );
+            b = ( read_4( p + len - 4 ) << 32 ) | read_4( p + len - 4 - ( ( len >> 3 ) << 2 ) );
+        } elif( len>0 ) {
+            a = ( (ullong) p[0] << 16 ) | ( (ullong) p[ len >> 1 ] << 8 ) | p[ len - 1 ];
+        }} else { ulong i = len;
+
+        if( i>48 ){ ullong see1 = seed, see2 = seed; do {
+            seed = mix( read_8( p      ) ^ HASH_P1, read_8( p +  8 ) ^ seed );
+            see1 = mix( read_8( p + 16 ) ^ HASH_P2, read_8( p + 24 ) ^ see1 );
+            see2 = mix( read_8( p + 32 ) ^ HASH_P3, read_8( p + 40 ) ^ see2 );
+            p += 48; i -= 48; } while( i>48 ); seed ^= see1 ^ see2;
+        }
+
+        while( i>16 ){ seed = mix( read_8( p ) ^ HASH_P1, read_8( p + 8 ) ^ seed ); i -= 16; p += 16; }
+            a = read_8( p + i - 16 ); b = read_8( p + i - 8 );
+        }
+
+        a ^= HASH_P1; b ^= seed; mul( a, b );
+        return (ulong) mix( a ^ HASH_P0 ^ len, b ^ HASH_P1 );
+    }
+
+    inline ulong get( ullong key ) noexcept {
+        return (ulong) mix( key ^ get_seed() ^ HASH_P0, HASH_P1 );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp {
+
+    /* hasher_t<K> turns a map_t key into a hash. Integers and pointers are *
+     * mixed directly, string_t is hashed in place; any other type goes    *
+     * through string::to_string(), unless it has a specialization here.   */
+
+    template< class T > struct hasher_t {
+        ulong operator()( const T& key ) const noexcept {
+            auto str = string::to_string( key ); return hash::get( str.data(), str.size() );
+        }
+    };
+
+    template< class T > struct hasher_t<T*> {
+        ulong operator()( T* key ) const noexcept { return hash::get( (ullong) (size_t) key ); }
+    };
+
+    template<> struct hasher_t<string_t> {
+        ulong operator()( const string_t& key ) const noexcept { return hash::get( key.data(), key.size() ); }
+    };
+
+    template< class T > struct hasher_int_t {
+        ulong operator()( const T& key ) const noexcept { return hash::get( (ullong) key ); }
+    };
+
+    template<> struct hasher_t<bool>     : hasher_int_t<bool>     {};
+    template<> struct hasher_t<char>     : hasher_int_t<char>     {};
+    template<> struct hasher_t<uchar>    : hasher_int_t<uchar>    {};
+    template<> struct hasher_t<short>    : hasher_int_t<short>    {};
+    template<> struct hasher_t<ushort>   : hasher_int_t<ushort>   {};
+    template<> struct hasher_t<int>      : hasher_int_t<int>      {};
+    template<> struct hasher_t<uint>     : hasher_int_t<uint>     {};
+    template<> struct hasher_t<long>     : hasher_int_t<long>     {};
+    template<> struct hasher_t<ulong>    : hasher_int_t<ulong>    {};
+    template<> struct hasher_t<llong>    : hasher_int_t<llong>    {};
+    template<> struct hasher_t<ullong>   : hasher_int_t<ullong>   {};
+    template<> struct hasher_t<wchar_t>  : hasher_int_t<wchar_t>  {};
+    template<> struct hasher_t<char16_t> : hasher_int_t<char16_t> {};
+    template<> struct hasher_t<char32_t> : hasher_int_t<char32_t> {};
+
+}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
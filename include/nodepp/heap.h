@@ -0,0 +1,104 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_HEAP
+#define NODEPP_HEAP
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class V > class heap_t {
+private:
+
+    struct NODE_PAIR { ulong first; V second; ulong order; };
+
+protected:
+
+    struct NODE {
+        ptr_t<NODE_PAIR> buffer;
+        ulong length=0, order=0;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    /* equal keys pop in insertion order, so tasks that wake on the same tick *
+     * run in the order they were scheduled.                                 */
+
+    bool less( const NODE_PAIR& x, const NODE_PAIR& y ) const noexcept {
+        return x.first < y.first || ( x.first==y.first && x.order < y.order );
+    }
+
+    /*─······································································─*/
+
+    /* 4-ary layout: children of idx live at idx*4+1 .. idx*4+4, which keeps *
+     * every level of a sift inside one or two cache lines.                  */
+
+    void sift_up( ulong idx ) const noexcept {
+        NODE_PAIR* buf = obj->buffer.data(); NODE_PAIR tmp = type::move( buf[idx] );
+        while( idx > 0 ){ ulong parent = ( idx-1 ) / 4;
+        if   ( !less( tmp, buf[parent] ) ){ break; }
+               buf[idx] = type::move( buf[parent] ); idx = parent; }
+        buf[idx] = type::move( tmp );
+    }
+
+    void sift_down( ulong idx ) const noexcept {
+        NODE_PAIR* buf = obj->buffer.data(); NODE_PAIR tmp = type::move( buf[idx] );
+        while( true ){ ulong x = idx*4+1, z = x; if( x >= obj->length ){ break; }
+        ulong y = min( x+4, obj->length ); while( ++x<y ){
+        if   ( less( buf[x], buf[z] ) ){ z=x; }}
+        if   ( !less( buf[z], tmp ) ){ break; }
+               buf[idx] = type::move( buf[z] ); idx = z; }
+        buf[idx] = type::move( tmp );
+    }
+
+    void reserve( ulong size ) const noexcept {
+        if( size <= obj->buffer.size() ){ return; }
+        ptr_t<NODE_PAIR> n_buffer ( max( size, obj->buffer.size()*2 ) );
+        for( ulong x=0; x<obj->length; ++x )
+           { n_buffer[x] = type::move( obj->buffer[x] ); }
+        obj->buffer = n_buffer;
+    }
+
+public:
+
+    heap_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+    /*─······································································─*/
+
+    ulong size() const noexcept { return obj->length; }
+
+    bool empty() const noexcept { return obj->length==0; }
+
+    void clear() const noexcept { obj->buffer.reset(); obj->length=0; }
+
+    /*─······································································─*/
+
+    NODE_PAIR& top() const noexcept { return obj->buffer[0]; }
+
+    /*─······································································─*/
+
+    void push( ulong key, const V& value ) const noexcept {
+        reserve( obj->length+1 ); /*------------------*/
+        obj->buffer[ obj->length ] = NODE_PAIR({ key, value, obj->order++ });
+        sift_up( obj->length++ );
+    }
+
+    void pop() const noexcept { if( empty() ){ return; }
+        obj->buffer[0] = type::move( obj->buffer[ --obj->length ] );
+        obj->buffer[ obj->length ] = NODE_PAIR(); sift_down( 0 );
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -150,12 +150,13 @@ public:
 
     int read_header() noexcept { 
 
-        if( process::millis() > get_conn_timeout() ){ return -1; }
-        thread_local static ptr_t<regex_t> reg({
+        if( process::uptime() > get_conn_timeout() ){ return -1; }
+        thread_local static ptr_t<regex_t> reg = arena::outside([](){
+        return ptr_t<regex_t>({
             regex_t( "[^ \r]+" ),
             regex_t( "^[^?#]+" ),
             regex_t( "?[^#]+"  )
-        });
+        }); });
         
     bool b=1; coBegin
     
@@ -215,7 +216,7 @@ public:
             while( fetch->file.is_available() ){ write( fetch->file.read() ); } //write( "\r\n" ); 
         } elif( !fetch->body.empty() ) { 
             res += string::format("Content-Length: %lu\r\n\r\n",fetch->body.size());
-            res += fetch->body; /*res+="\r\n";*/ write( res );
+            buffer_chain_t out ( res ); out.push( fetch->body ); write( out );
         } else { res += "\r\n"; write( res ); }
 
     }
@@ -229,7 +230,13 @@ namespace nodepp { namespace http {
     inline tcp_t server( function_t<void,http_t> cb, agent_t* opt=nullptr ){
         return tcp_t([=]( http_t cli ){
 
-            int c=0; while((c=cli.read_header())==1){ /*unused*/ }
+            /* headers, paths and their strings are parsed into a per-request *
+             * arena that goes back to malloc at once when they are dropped.  */
+
+            int c=0; arena_t mem; mem.use([&](){ cli.headers = header_t();
+                while((c=cli.read_header())==1){ /*unused*/ }
+            });
+
             if( c==0 ){ cb(cli); return; }
             
         cli.close(); }, opt );
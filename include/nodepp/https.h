@@ -48,12 +48,13 @@ public:
 
     int read_header() noexcept {  
 
-        if( process::millis() > get_conn_timeout() ){ return -1; }
-        thread_local static ptr_t<regex_t> reg({
+        if( process::uptime() > get_conn_timeout() ){ return -1; }
+        thread_local static ptr_t<regex_t> reg = arena::outside([](){
+        return ptr_t<regex_t>({
             regex_t( "[^ \r]+" ),
             regex_t( "^[^?#]+" ),
             regex_t( "?[^#]+"  )
-        });
+        }); });
         
     bool b=1; coBegin
     
@@ -113,7 +114,7 @@ public:
             while( fetch->file.is_available() ){ write( fetch->file.read() ); } //write( "\r\n" ); 
         } elif( !fetch->body.empty() ) { 
             res += string::format("Content-Length: %lu\r\n\r\n",fetch->body.size());
-            res += fetch->body; /*res+="\r\n";*/ write( res );
+            buffer_chain_t out ( res ); out.push( fetch->body ); write( out );
         } else { res += "\r\n"; write( res ); }
 
     }
@@ -127,7 +128,10 @@ namespace nodepp { namespace https {
     inline tls_t server( function_t<void,https_t> cb, ssl_t* ssl=nullptr, agent_t* opt=nullptr ){
         return tls_t([=]( https_t cli ){
 
-            int c=0; while((c=cli.read_header())==1){ /*unused*/ }
+            int c=0; arena_t mem; mem.use([&](){ cli.headers = header_t();
+                while((c=cli.read_header())==1){ /*unused*/ }
+            });
+
             if( c==0 ){ cb(cli); return; }
         
         cli.close(); }, ssl, opt );
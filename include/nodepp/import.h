@@ -26,17 +26,22 @@
 #include "task.h"
 #include "type.h"
 #include "atomic.h"
+#include "arena.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include "ptr.h"
+#include "algorithm.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include "iterator.h"
 #include "function.h"
 #include "queue.h"
+#include "ring.h"
+#include "heap.h"
 #include "probe.h"
+#include "inbox.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -53,6 +58,8 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include "loop.h"
+#include "wheel.h"
+#include "reactor.h"
 #include "signal.h"
 #include "except.h"
 
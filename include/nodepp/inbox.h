@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_INBOX
+#define NODEPP_INBOX
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class T > class inbox_t {
+private:
+
+    /* lock-free multi-producer / single-consumer queue ( Vyukov ). Any   *
+     * thread may push(); only the owner thread may pop(). push() returns *
+     * true only for the first item since the last ack(), so a burst of   *
+     * posts needs a single wakeup of the consumer.                       */
+
+    struct NODE_ITEM { atomic_t<NODE_ITEM*> next; T data; };
+
+protected:
+
+    struct NODE {
+        atomic_t<NODE_ITEM*> head;
+        NODE_ITEM  *tail, stub;
+        atomic_t<ulong> size;
+        atomic_t<bool>  signal;
+       ~NODE() noexcept { while( tail!=nullptr ){ auto x = tail->next.get();
+        if ( tail!=&stub ){ delete tail; } tail = x; }}
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    void link( NODE_ITEM* item ) const noexcept {
+        item->next.set( nullptr );
+        auto prev = obj->head.swap( item );
+        prev->next.set( item );
+    }
+
+public:
+
+    inbox_t() noexcept : obj( ptr::make<NODE>() ) {
+        obj->head.set( &obj->stub ); obj->tail = &obj->stub;
+    }
+
+    /*─······································································─*/
+
+    ulong size() const noexcept { return obj->size.get(); }
+
+    bool empty() const noexcept { return size()==0; }
+
+    /*─······································································─*/
+
+    bool push( const T& value ) const noexcept {
+        auto item = new NODE_ITEM(); item->data = value;
+        ++obj->size; link( item ); return !obj->signal.swap( true );
+    }
+
+    void ack() const noexcept { obj->signal.set( false ); }
+
+    /*─······································································─*/
+
+    bool pop( T& out ) const noexcept {
+        NODE_ITEM* tail = obj->tail; NODE_ITEM* next = tail->next.get();
+
+        if( tail == &obj->stub ){ if( next==nullptr ){ return false; }
+            obj->tail = next; tail = next; next = next->next.get();
+        }
+
+        if( next == nullptr ){
+        if( tail != obj->head.get() ){ return false; }
+            link( &obj->stub ); next = tail->next.get();
+        if( next == nullptr ){ return false; }
+        }
+
+        obj->tail = next; out = tail->data;
+        delete tail; --obj->size; return true;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
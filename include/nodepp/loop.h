@@ -18,59 +18,71 @@ namespace nodepp { class loop_t {
 private:
 
     using NODE_CLB = function_t<int>;
-    using NODE_TASK= type::pair<ulong,void*>;
-    using NODE_PAIR= type::pair<NODE_CLB,ref_t<task_t>>;
+    struct NODE_PAIR { NODE_CLB first; ref_t<task_t> second; int lane; };
+
+    /* after LANE_BURST high-lane tasks in a row, one normal-lane task runs *
+     * so request handlers are never fully starved by high-priority work.   */
+
+    enum LANE { LANE_BURST = 8 };
+
+    /* a lane is a FIFO of task nodes: each run pops the front and pushes *
+     * the task back unless it closed or went to sleep. left counts down  *
+     * one round over the lane, so next() returns -1 once per round.      *
+     * busy counts tasks off their lane because they are still running.   */
+
+    struct NODE_LANE { ring_t<void*> list; ulong left=0; };
 
 protected:
 
     struct NODE {
         queue_t<NODE_PAIR> queue;
-        queue_t<void*>     normal;
-        queue_t<NODE_TASK> blocked;
+        NODE_LANE          high, normal, idle;
+        heap_t <void*>     blocked;
+        ulong              burst=0, busy=0;
+        NODEPP_STATS( loop_stats_t st; )
     };  ptr_t<NODE> obj;
 
     /*─······································································─*/
 
-    void* get_nearest_timeout( ulong time ) const noexcept {
-    
-        auto x = obj->blocked.last(); while( x!=nullptr ){
-        if( time>=x->data.first ){ return x->next; }
-        x = x->prev; }
-
-    return obj->blocked.first(); }
+    NODE_LANE& get_lane( int lane ) const noexcept {
+        switch( lane ){
+            case TASK_PRIORITY::HIGH: return obj->high;
+            case TASK_PRIORITY::IDLE: return obj->idle;
+            default: /*------------*/ return obj->normal;
+        }
+    }
 
     /*─······································································─*/
 
     inline int blocked_queue_next() const {
+        if( obj->blocked.empty() ){ return -1; }
         auto stamp = process::now();
         
-        do{ auto x = obj->blocked.first(); 
-        if( x == nullptr ) /*---*/ { return -1; }
-        if( x->data.first > stamp ){ return -1; }
-
-        if( x->data.first < stamp ){
-            obj->normal .push ( x->data.second ); 
-            obj->blocked.erase( x );
-        } else { break; }} while(1); return 1;
+        do{ if( obj->blocked.empty() ) /*---------*/ { break;     }
+            if( obj->blocked.top().first > stamp ){ return -1; }
+            NODEPP_STATS( obj->st.add_lag( stamp - obj->blocked.top().first ); )
+            auto y = obj->queue.as( obj->blocked.top().second );
+            get_lane( y->data.lane ).list.push( y ); 
+            obj->blocked.pop (); 
+        } while(1); return 1;
 
     }
 
     /*─······································································─*/
 
-    inline int normal_queue_next() const {
+    inline int lane_queue_next( NODE_LANE& lane ) const {
     
-        if( obj->normal.empty() ) /*-*/ { return -1; } do {
-        if( obj->normal.get()==nullptr ){ return -1; }
+        if( lane.list.empty() ) /*-*/ { return -1; } do {
+        if( lane.left==0 ){ lane.left = lane.list.size(); }
 
-        auto x = obj->normal.get(); auto y = obj->queue.as(x->data);
-        auto o = obj->normal.get() == obj->normal.last() ? -1 : 1;
+        auto x = lane.list.first(); auto y = obj->queue.as(x);
+        auto o = --lane.left==0 ? -1 : 1; lane.list.shift();
         
         if( y->data.second->flag & TASK_STATE::USED   ){ 
-            obj->normal.next(); 
+            lane.list.push( x ); 
         return 0; }
         
         if( y->data.second->flag & TASK_STATE::CLOSED ){ 
-            obj->normal.erase(x);
             obj->queue .erase(y); 
         return 1; } 
 
@@ -78,7 +90,9 @@ protected:
 
         int c=0; ulong d=0; while( ([&](){
             
-            do{ c=y->data.first(); auto z=coroutine::getno();
+            NODEPP_STATS( ulong t=process::micros(); )
+            do{ ++obj->busy; c=y->data.first(); --obj->busy; auto z=coroutine::getno();
+            NODEPP_STATS( obj->st.add_task( process::micros()-t ); )
             if( c==1 && z.flag&coroutine::STATE::CO_STATE_DELAY )
               { d=z.delay; goto GOT3; } switch(c) {
                 case  1 :  goto GOT1;   break;
@@ -89,12 +103,12 @@ protected:
             GOT1:;
 
                 y->data.second->flag &=~ TASK_STATE::USED; 
-                obj->normal.next(); return -1;
+                lane.list.push( x ); return -1;
 
             GOT2:;
 
                 y->data.second->flag = TASK_STATE::CLOSED;
-                /*---------------*/ return -1;
+                lane.list.push( x ); return -1;
 
             GOT3:;
 
@@ -103,20 +117,23 @@ protected:
                 y->data.second->flag &=~ TASK_STATE::USED;  
                 ulong wake_time = d + process::now();
 
-                auto z = obj->blocked.as( get_nearest_timeout( wake_time ) );
-                obj->blocked.insert( z, NODE_TASK( { wake_time, y } ));
-                obj->normal .erase(x); 
+                obj->blocked.push ( wake_time, y );
 
             return -1; } while(0);
 
             GOT4:;
 
+                lane.list.unshift( x ); ++lane.left;
+
         return -1; })() >= 0 ){ /* unused */ }
         return  o; } while(0); return -1;
 
     }
 
-public: loop_t() noexcept : obj( new NODE() ) {}
+public: loop_t() noexcept : obj( ptr::make<NODE>() ) {
+        obj->queue.set_slab( true );
+        NODEPP_STATS( obj->st.stamp = process::millis(); )
+    }
 
     /*─······································································─*/
 
@@ -131,39 +148,66 @@ public: loop_t() noexcept : obj( new NODE() ) {}
 
     /*─······································································─*/
 
-    int get_delay() const noexcept { 
-        if(!obj->normal .empty() ){ return  0; }
+    /* a running task is still pending work: a nested process::next() *
+     * from inside it ( channel_t::read(), socket waits ) must not block.*/
+
+    int get_delay() const noexcept { if( obj->busy>0 ){ return 0; }
+        if(!obj->high   .list.empty() ||
+           !obj->normal .list.empty() ||
+           !obj->idle   .list.empty() ){ return  0; }
         if( obj->blocked.empty() ){ return -1; }
-        return obj->blocked.first()->data.first - process::now();
+        ulong wake = obj->blocked.top().first, stamp = process::now();
+        return wake > stamp ? wake - stamp : 0;
     }
 
     /*─······································································─*/
 
     ulong size() const noexcept { return obj->queue.size  (); }
 
+    loop_stats_t get_stats() const noexcept { loop_stats_t out;
+        NODEPP_STATS( out = obj->st; )
+        out.ev_queue = obj->queue  .size();
+        out.blocked  = obj->blocked.size();
+    return out; }
+
     bool empty() const noexcept { return obj->queue.empty (); }
 
     /*─······································································─*/
 
-    inline int next() const /*--*/ { 
-        /*--*/ blocked_queue_next();
-        return normal_queue_next ();
-    }
+    /* strict priority between lanes: high before normal (see LANE_BURST), *
+     * idle only when both are empty and the caller has no I/O pending.    */
+
+    inline int next( bool idle=true ) const { 
+        NODEPP_STATS( ++obj->st.iteration; ) blocked_queue_next();
+
+        if( !obj->high.list.empty() && ( obj->normal.list.empty() || obj->burst < LANE_BURST ) )
+          { ++obj->burst; return lane_queue_next( obj->high ); } obj->burst = 0;
+        if( !obj->normal.list.empty() ){ return lane_queue_next( obj->normal ); }
+        if( idle ) /*----------*/ { return lane_queue_next( obj->idle   ); }
+
+    return -1; }
 
     void clear() const noexcept { 
         obj->queue  .clear(); 
-        obj->normal .clear(); 
-        obj->blocked.clear(); 
+        obj->high   .list.clear(); obj->high  .left=0;
+        obj->normal .list.clear(); obj->normal.left=0;
+        obj->idle   .list.clear(); obj->idle  .left=0;
+        obj->blocked.clear(); obj->burst=0;
     }
 
     /*─······································································─*/
 
     template< class T, class... V >
     ptr_t<task_t> add( T cb, const V&... args ) const noexcept {
+        return add( TASK_PRIORITY::NORMAL, cb, args... );
+    }
+
+    template< class T, class... V >
+    ptr_t<task_t> add( TASK_PRIORITY::TYPE lane, T cb, const V&... args ) const noexcept {
     ptr_t<task_t> tsk( 0UL, task_t() ); auto clb = type::bind( cb );
 
-        obj->queue .push({[=](){ return (*clb)( args... );}, tsk });
-        obj->normal.push( obj->queue.last() ); 
+        obj->queue .push({[=](){ return (*clb)( args... );}, tsk, lane });
+        get_lane( lane ).list.push( obj->queue.last() ); 
 
         tsk->addr = obj->queue.last();
         tsk->flag = TASK_STATE::OPEN ;
@@ -15,66 +15,159 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include "encoder.h"
+#include "hash.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { template<class U, class V> class map_t {
 protected:
 
+    /* open addressing over a power-of-two table ( Swiss table layout ):   *
+     * one control byte per slot keeps 7 bits of the hash, and probing     *
+     * compares MAP_GROUP of them at once. Pairs stay in queue nodes, in   *
+     * insertion order, so references from operator[] survive a rehash.   */
+
+    enum MAP {
+         MAP_GROUP = 16,
+         MAP_EMPTY = 0x80,
+         MAP_TOMB  = 0xFE
+    };
+
     using T    = type::pair< U, V >;
-    using LIST = queue_t<void*>;
+    using ITEM = decltype( queue_t<T>().first() );
+
+    struct NODE_SLOT { ulong hash; void* item; };
 
     struct NODE {
-        ptr_t<LIST> table;
-        queue_t<T>  queue;
+        ptr_t<uchar>     ctrl;
+        ptr_t<NODE_SLOT> slot;
+        queue_t<T>       queue;
+        ulong mask=0, used=0;
     };  ptr_t<NODE> obj;
 
 protected:
 
-    void append( const T& pair ) const noexcept {
-
-        auto  key = string::to_string(pair.first);
-        ulong idx = encoder::hash::get(key);
-        auto  n   = obj->table[idx].first();
+    ulong hash( const U& id ) const noexcept { return hasher_t<U>()( id ); }
+
+    uint match( ulong pos, uchar value ) const noexcept {
+        const uchar* ctrl = obj->ctrl.data() + pos;
+    #ifdef __SSE2__
+        __m128i x = _mm_loadu_si128( (const __m128i*) ctrl );
+        return (uint) _mm_movemask_epi8( _mm_cmpeq_epi8( x, _mm_set1_epi8( (char) value ) ) );
+    #else
+        uint out = 0; for( uint x=0; x<MAP_GROUP; ++x )
+           { if( ctrl[x]==value ){ out |= 1U << x; } } return out;
+    #endif
+    }
 
-        while( n!=nullptr ){
-        auto itm = obj->queue.as(n->data); if( itm==nullptr ){ break; }
-        if ( itm->data.first == pair.first ){
-             itm->data.second = pair.second;
-        return; } n = n->next; }
+    uint match_free( ulong pos ) const noexcept {
+        const uchar* ctrl = obj->ctrl.data() + pos;
+    #ifdef __SSE2__
+        return (uint) _mm_movemask_epi8( _mm_loadu_si128( (const __m128i*) ctrl ) );
+    #else
+        uint out = 0; for( uint x=0; x<MAP_GROUP; ++x )
+           { if( ctrl[x] & 0x80 ){ out |= 1U << x; } } return out;
+    #endif
+    }
 
-        obj->queue.push( pair );
-        obj->table[idx].push( obj->queue.last() );
+    uint lowest( uint bits ) const noexcept {
+    #ifdef __GNUC__
+        return __builtin_ctz( bits );
+    #else
+        uint out = 0; while( ( bits & 1 )==0 ){ bits >>= 1; ++out; } return out;
+    #endif
+    }
 
+    void set_ctrl( ulong idx, uchar value ) const noexcept {
+        obj->ctrl[idx] = value; if( idx < MAP_GROUP )
+      { obj->ctrl[ idx + obj->mask + 1 ] = value; }
     }
 
-public:
+    /*─······································································─*/
 
-    template< ulong N >
-    map_t( const T (&args) [N] ) noexcept : obj( new NODE() ) {
-        obj->table = ptr_t<LIST>( HASH_TABLE_SIZE );
-        for( auto &x: args ) { append(x); }
+    ITEM find( const U& id, ulong key, ulong* out=nullptr ) const noexcept {
+        if( obj->ctrl.null() ){ return nullptr; }
+        ulong pos = ( key >> 7 ) & obj->mask; uchar h2 = key & 0x7F;
+
+        for( ulong step=MAP_GROUP; ; step+=MAP_GROUP ){
+            uint bits = match( pos, h2 ); while( bits!=0 ){
+                ulong idx = ( pos + lowest( bits ) ) & obj->mask;
+                auto  itm = obj->queue.as( obj->slot[idx].item );
+            if( obj->slot[idx].hash==key && itm->data.first==id )
+              { if( out!=nullptr ){ *out=idx; } return itm; }
+                bits &= bits - 1;
+            }   if( match( pos, MAP_EMPTY )!=0 ){ return nullptr; }
+                pos = ( pos + step ) & obj->mask;
+        }
+    }
+
+    ulong find_free( ulong key ) const noexcept {
+        ulong pos = ( key >> 7 ) & obj->mask;
+        for( ulong step=MAP_GROUP; ; step+=MAP_GROUP ){
+            uint bits = match_free( pos ); if( bits!=0 )
+          { return ( pos + lowest( bits ) ) & obj->mask; }
+            pos = ( pos + step ) & obj->mask;
+        }
     }
 
-    map_t() noexcept : obj( new NODE() ) {
-        obj->table = ptr_t<LIST>( HASH_TABLE_SIZE );
+    void rehash( ulong size ) const noexcept {
+        auto ctrl = obj->ctrl; auto slot = obj->slot; ulong mask = obj->mask;
+
+        obj->ctrl = ptr_t<uchar>( size + MAP_GROUP, (uchar) MAP_EMPTY );
+        obj->slot = ptr_t<NODE_SLOT>( size, NODE_SLOT { 0, nullptr } );
+        obj->mask = size - 1; obj->used = obj->queue.size();
+
+        /* only the control bytes tell live slots apart: EMPTY and TOMB   *
+         * both have 0x80 set, and their slot may hold stale data.        */
+
+        if( ctrl.null() ){ return; } for( ulong x=0; x<=mask; ++x ){
+        if( ctrl[x] & 0x80 ){ continue; }
+            ulong idx = find_free( slot[x].hash );
+            set_ctrl( idx, slot[x].hash & 0x7F ); obj->slot[idx] = slot[x];
+        }
     }
 
     /*─······································································─*/
 
-    V& operator[]( const U& id ) const noexcept {
+    ITEM append( const T& pair, ulong key ) const noexcept {
+
+        if( obj->ctrl.null() ){ rehash( MAP_GROUP ); }
+        if( ( obj->used + 1 ) * 8 > ( obj->mask + 1 ) * 7 ){
+            ulong size = obj->mask + 1;
+            rehash( obj->queue.size() * 2 >= size ? size * 2 : size );
+        }
 
-        auto key = string::to_string( id );
-        ulong idx= encoder::hash::get(key);
-        auto n   = obj->table[idx].first();
+        ulong idx = find_free( key ); obj->queue.push( pair );
+        if( obj->ctrl[idx]==MAP_EMPTY ){ ++obj->used; }
+        set_ctrl( idx, key & 0x7F ); obj->slot[idx] = { key, obj->queue.last() };
 
-        while( n!=nullptr ){
-        auto itm = obj->queue.as(n->data); if( itm==nullptr ){ break; }
-        if ( itm->data.first==id ){ return itm->data.second; }
-        n = n->next; } append({ id, V() });
+    return obj->queue.last(); }
 
-        return obj->queue.last()->data.second;
+    void append( const T& pair ) const noexcept {
+        ulong key = hash( pair.first ); auto itm = find( pair.first, key );
+        if( itm!=nullptr ){ itm->data.second = pair.second; return; }
+        append( pair, key );
+    }
+
+public:
+
+    template< ulong N >
+    map_t( const T (&args) [N] ) noexcept : obj( ptr::make<NODE>() ) {
+        for( auto &x: args ) { append(x); }
+    }
+
+    map_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+    /*─······································································─*/
 
+    V& operator[]( const U& id ) const noexcept {
+        ulong key = hash( id ); auto itm = find( id, key );
+        if( itm!=nullptr ){ return itm->data.second; }
+        return append( { id, V() }, key )->data.second;
     }
 
     /*─······································································─*/
@@ -88,17 +181,7 @@ public:
     /*─······································································─*/
 
     bool has( const U& id ) const noexcept {
-
-        auto  key = string::to_string( id );
-        ulong idx = encoder::hash::get(key);
-        auto  n   = obj->table[idx].first();
-
-        while( n!=nullptr ){
-        auto itm = obj->queue.as(n->data); if( itm==nullptr ){ break; }
-        if ( itm->data.first==id ){ return true; } n = n->next; }
-
-        return false;
-
+        return find( id, hash( id ) )!=nullptr;
     }
 
     /*─······································································─*/
@@ -118,23 +201,14 @@ public:
     /*─······································································─*/
 
     void erase( const U& id ) const noexcept {
-
-        auto  key = string::to_string( id );
-        ulong idx = encoder::hash::get(key);
-        auto  n   = obj->table[idx].first();
-
-        while( n!=nullptr ){
-        auto itm = obj->queue.as(n->data); if( itm==nullptr ){ return; }
-        if ( itm->data.first==id ){ obj->queue.erase(itm); break; }
-        n = n->next; } if( n==nullptr ) { return; }
-
-        obj->table[idx].erase( n );
-
+        ulong idx=0; auto itm = find( id, hash( id ), &idx );
+        if( itm==nullptr ){ return; } obj->queue.erase( itm );
+        set_ctrl( idx, MAP_TOMB ); obj->slot[idx].item = nullptr;
     }
 
     void erase() const noexcept {
-        for( auto x: obj->table ){ x.erase(); }
-        obj->queue.erase();
+        obj->ctrl.reset(); obj->slot.reset();
+        obj->mask = obj->used = 0; obj->queue.erase();
     }
 
     void clear() const noexcept { erase(); }
@@ -79,16 +79,16 @@ protected:
 public:
 
     template< ulong N >
-    object_t( const T (&arr) [N] ) : obj( new NODE() ) {
+    object_t( const T (&arr) [N] ) : obj( ptr::make<NODE>() ) {
         QUEUE mem; for( ulong x=0; x<N; ++x )
             { mem[arr[x].first]= arr[x].second; }
         obj->mem = mem; obj->type = 20;
     }
 
-    object_t( null_t ) : obj( new NODE() ) { /*---*/ }
+    object_t( null_t ) : obj( ptr::make<NODE>() ) { /*---*/ }
 
     template< class U >
-    object_t( const U& any ) : obj( new NODE() ) {
+    object_t( const U& any ) : obj( ptr::make<NODE>() ) {
         if( type::is_same<U,ARRAY>::value )
           { obj->type = 21; goto BACK; }
       elif( type::is_same<U,QUEUE>::value )
@@ -97,7 +97,7 @@ public:
         BACK:; obj->mem = any;
     }
 
-    object_t() : obj( new NODE() ){}
+    object_t() : obj( ptr::make<NODE>() ){}
 
     /*─······································································─*/
 
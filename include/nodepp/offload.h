@@ -0,0 +1,179 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_OFFLOAD
+#define NODEPP_OFFLOAD
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include "os.h"
+#include "fs.h"
+#include "dns.h"
+#include "worker.h"
+#include "promise.h"
+#include "semaphore.h"
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class pool_t {
+private:
+
+    /* threads are started on demand up to limit() ( at least 4, since   *
+     * jobs mostly sit in blocking syscalls ). Idle ones block on a       *
+     * semaphore posted once per job and leave after POOL_LINGER ms       *
+     * without one, so an idle pool never keeps a loop alive for long.    */
+
+    enum POOL { POOL_LINGER = 100 };
+
+    using NODE_JOB = function_t<void>;
+
+protected:
+
+    struct NODE {
+        queue_t<NODE_JOB> queue; mutex_t mut; semaphore_t sem;
+        atomic_t<ulong>   alive, idle;
+        ulong limit=1;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    bool take( NODE_JOB& job ) const noexcept { bool done = false;
+        obj->mut.lock([&](){ if( obj->queue.empty() ){ return; }
+            job = obj->queue.first()->data; obj->queue.shift();
+            --obj->idle; done = true;
+        }); return done;
+    }
+
+    bool retire() const noexcept { bool done = false;
+        obj->mut.lock([&](){ if( !obj->queue.empty() ){ return; }
+            --obj->idle; --obj->alive; done = true;
+        }); return done;
+    }
+
+    void spawn() const noexcept { auto self = type::bind( this );
+        worker::add([=](){ NODE_JOB job; while( true ){
+            if( !self->obj->sem.wait( POOL_LINGER ) ){
+                if( self->retire() ){ break; } continue; }
+            if( self->take( job ) ){ job(); job = nullptr; ++self->obj->idle; }
+        }   return -1; });
+    }
+
+public:
+
+    pool_t( ulong threads=0 ) noexcept : obj( ptr::make<NODE>() ) {
+        obj->limit = threads==0 ? max( 4U, os::cpus() ) : threads;
+    }
+
+    /*─······································································─*/
+
+    ulong limit() const noexcept { return obj->limit; }
+
+    ulong size() const noexcept { return obj->alive.get(); }
+
+    bool empty() const noexcept { bool out=true;
+        obj->mut.lock([&](){ out = obj->queue.empty(); }); return out;
+    }
+
+    /*─······································································─*/
+
+    template< class T, class... V >
+    void add( T cb, const V&... args ) const noexcept {
+        auto clb = type::bind( cb ); bool grow = false;
+        obj->mut.lock([&](){
+            obj->queue.push([=](){ (*clb)( args... ); }); obj->sem.post();
+            if( obj->idle.get()==0 && obj->alive.get()<obj->limit )
+              { ++obj->alive; ++obj->idle; grow = true; }
+        }); if( grow ){ spawn(); }
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    inline pool_t& get_pool(){ static pool_t pool; return pool; }
+
+    /* runs cb( args... ) on the shared pool_t and settles the promise back *
+     * on the calling thread's loop. cb must return a value; a thrown      *
+     * except_t rejects the promise.                                       */
+
+    template< class U, class... V >
+    auto offload( U cb, const V&... args ) -> promise_t< decltype( cb( args... ) ), except_t > {
+        using T = decltype( cb( args... ) ); auto clb = type::bind( cb );
+        struct NODE_REPLY { res_t<T> res; rej_t<except_t> rej; };
+
+    return promise_t<T,except_t>([=]( res_t<T> res, rej_t<except_t> rej ){
+        auto reply = new NODE_REPLY({ res, rej }); auto hd = process::handle();
+
+        get_pool().add([=](){ try { T out = (*clb)( args... );
+            hd.post([=](){ reply->res( out ); delete reply; return -1; });
+        } catch( except_t err ) {
+            hd.post([=](){ reply->rej( err ); delete reply; return -1; });
+        } catch( ... ) {
+            hd.post([=](){ reply->rej( except_t( "offload failed" ) ); delete reply; return -1; });
+        }});
+
+    }); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace fs { namespace async {
+
+    inline promise_t<string_t,except_t> read_file( const string_t& path ){
+    return process::offload([=](){ return fs::read_file( path ); }); }
+
+    inline promise_t<bool,except_t> write_file( const string_t& path, const string_t& data ){
+    return process::offload([=](){ fs::write_file( path, data ); return true; }); }
+
+    inline promise_t<bool,except_t> append_file( const string_t& path, const string_t& data ){
+    return process::offload([=](){ fs::append_file( path, data ); return true; }); }
+
+    inline promise_t<int,except_t> copy_file( const string_t& src, const string_t& des ){
+    return process::offload([=](){ return fs::copy_file( src, des ); }); }
+
+    inline promise_t<int,except_t> remove_file( const string_t& path ){
+    return process::offload([=](){ return fs::remove_file( path ); }); }
+
+    inline promise_t<bool,except_t> exists_file( const string_t& path ){
+    return process::offload([=](){ return fs::exists_file( path ); }); }
+
+    inline promise_t<ulong,except_t> file_size( const string_t& path ){
+    return process::offload([=](){ return fs::file_size( path ); }); }
+
+    inline promise_t<ptr_t<string_t>,except_t> read_folder( const string_t& path ){
+    return process::offload([=](){ return fs::read_folder( path ); }); }
+
+}}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace dns { namespace async {
+
+    inline promise_t<string_t,except_t> lookup( const string_t& host ){
+    return process::offload([=](){ auto ip = dns::lookup( host );
+        if( ip.empty() ){ throw except_t( "dns couldn't get ip" ); } return ip;
+    }); }
+
+    inline promise_t<string_t,except_t> lookup_ipv6( const string_t& host ){
+    return process::offload([=](){ auto ip = dns::lookup_ipv6( host );
+        if( ip.empty() ){ throw except_t( "dns couldn't get ip" ); } return ip;
+    }); }
+
+}}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -22,9 +22,9 @@ protected:
 
 public:
 
-    optional_t( const T& val ) noexcept : obj( new NODE() ) { obj->has = true ; obj->data = val; }
+    optional_t( const T& val ) noexcept : obj( ptr::make<NODE>() ) { obj->has = true ; obj->data = val; }
 
-    optional_t( /*--------*/ ) noexcept : obj( new NODE() ) { obj->has = false; }
+    optional_t( /*--------*/ ) noexcept : obj( ptr::make<NODE>() ) { obj->has = false; }
 
     /*─······································································─*/
 
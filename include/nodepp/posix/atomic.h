@@ -85,7 +85,7 @@ public:
     }
 
     bool compare( T& expected, T desired ) const noexcept {
-        return __atomic_compare_exchange_n( &value, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST );
+        return __atomic_compare_exchange_n( (T*) &value, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST );
     }
 
 public:
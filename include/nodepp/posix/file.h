@@ -15,6 +15,7 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include <sys/file.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <fcntl.h>
 
@@ -60,6 +61,7 @@ protected:
         generator::file::line  _line ;
         generator::file::read  _read ;
         generator::file::write _write;
+        generator::file::writev _writev;
     };  ptr_t<NODE> obj;
 
     /*─······································································─*/
@@ -111,20 +113,20 @@ public:
 
     /*─······································································─*/
 
-    file_t( const string_t& path, const string_t& mode, const ulong& _size=CHUNK_SIZE ) : obj( new NODE() ) {
+    file_t( const string_t& path, const string_t& mode, const ulong& _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) {
             obj->fd = open( path.data(), get_fd_flag( mode ), 0644 ); /*-----------*/
         if( obj->fd < 0 ){ throw except_t("such file or directory does not exist"); }
         set_nonbloking_mode(); set_buffer_size( _size );
     }
 
-    file_t( const int& fd, const ulong& _size=CHUNK_SIZE ) : obj( new NODE() ) {
+    file_t( const int& fd, const ulong& _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) {
         if( fd<0 ){ throw except_t("such file or directory does not exist"); }
         obj->fd = fd; set_nonbloking_mode(); set_buffer_size( _size );
     }
 
    ~file_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
      
-    file_t() noexcept : obj( new NODE() ) {}
+    file_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
@@ -242,10 +244,17 @@ public:
         return obj->_write.data;
     }
 
+    ulong write( const buffer_chain_t& msg ) const noexcept {
+        while( obj->_writev( this, msg ) == 1 )
+             { process::next(); }
+        return obj->_writev.data;
+    }
+
     /*─······································································─*/
 
     virtual int _read ( char* bf, const ulong& sx ) const noexcept { return __read ( bf, sx ); }
     virtual int _write( char* bf, const ulong& sx ) const noexcept { return __write( bf, sx ); }
+    virtual int _writev( const buffer_chain_t& bf ) const noexcept { return __writev( bf ); }
 
     /*─······································································─*/
 
@@ -263,6 +272,19 @@ public:
         return ( obj->feof <= 0 && obj->feof != -2 ) ? -2 : obj->feof;
     }
 
+    virtual int __writev( const buffer_chain_t& bf ) const noexcept {
+        if( is_closed() ){ return -1; } if( bf.empty() ){ return 0; }
+
+        struct iovec vec[ buffer_chain_t::CHAIN_IOV ]; int n=0;
+        auto x = bf.get_queue().first(); while( x!=nullptr && n<buffer_chain_t::CHAIN_IOV ){
+             vec[n].iov_base = x->data.data(); vec[n].iov_len = x->data.size(); ++n; x = x->next;
+        }
+
+        obj->feof = ::writev( obj->fd, vec, n );
+        obj->feof = is_blocked(obj->feof)? -2 : obj->feof;
+        return ( obj->feof <= 0 && obj->feof != -2 ) ? -2 : obj->feof;
+    }
+
     /*─······································································─*/
 
     int _write_( char* bf, const ulong& sx, ulong* sy ) const noexcept {
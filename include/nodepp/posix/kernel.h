@@ -13,11 +13,16 @@
 #define NODEPP_POSIX_KERNEL
 #if  ( _OS_ == NODEPP_OS_FRBSD ) || ( _OS_ == NODEPP_OS_APPLE )
     #define NODEPP_POLL_KPOLL
+#elif _OS_ == NODEPP_OS_LINUX && defined( NODEPP_POLL_URING )
+    /* opt-in io_uring backend, see NODEPP_POLL_URING below */
 #elif _OS_ == NODEPP_OS_LINUX
     #define NODEPP_POLL_EPOLL
 #else
     #define NODEPP_POLL_NPOLL
 #endif
+#if  _OS_ != NODEPP_OS_LINUX && defined( NODEPP_POLL_URING )
+    #undef  NODEPP_POLL_URING
+#endif
 #endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -28,10 +33,14 @@
 #include <sys/eventfd.h>
 #include <sys/epoll.h>
 #include "../loop.h"
+#include "../wheel.h"
+#include "../reactor.h"
 
-namespace nodepp { class kernel_t {
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
 private:
 
+    friend class reactor_t<kernel_t>;
+
     using EPOLLFD = struct epoll_event;
     using ETIMER  = struct timespec;
 
@@ -42,14 +51,17 @@ private:
          KV_STATE_EDGE    = 0b10000000,
          KV_STATE_USED    = 0b00000100,
          KV_STATE_AWAIT   = 0b00001100,
-         KV_STATE_CLOSED  = 0b00001000
+         KV_STATE_CLOSED  = 0b00001000,
+         KV_STATE_ERASE   = 0b00100000
     };
 
     struct kevent_t { public:
-        function_t<int> callback;
+        function_t<int> callback; void* timer; void* ready;
         ulong timeout; int fd, flag; 
     };
 
+    struct kfd_t { void* rd; void* wr; uint mask; };
+
     bool is_std( int fd ) const noexcept { 
         return fd == STDOUT_FILENO ||
                fd == STDIN_FILENO  ||
@@ -58,25 +70,64 @@ private:
 
 protected:
 
+    /* each fd owns one epoll registration shared by its read and write      *
+     * kevent_t, so adding or dropping a direction is an EPOLL_CTL_MOD.      */
+
+    kfd_t& get_kfd( int fd ) const noexcept {
+        if( (ulong) fd >= obj->kv_fd.size() ){
+            ptr_t<kfd_t> n_buffer ( max( (ulong) fd+1, obj->kv_fd.size()*2 ), kfd_t({ nullptr, nullptr, 0 }) );
+            for( ulong x=0; x<obj->kv_fd.size(); ++x ){ n_buffer[x] = obj->kv_fd[x]; }
+            obj->kv_fd = n_buffer;
+        }   return obj->kv_fd[ fd ];
+    }
+
+    void*& get_dir( kfd_t& x, int flag ) const noexcept {
+        return flag & FLAG::KV_STATE_READ ? x.rd : x.wr;
+    }
+
+    uint get_mask( const kfd_t& x ) const noexcept {
+        uint mask=0, edge=EPOLLET; /*--------------------------------------*/
+        if( x.rd!=nullptr ){ mask |= EPOLLIN ;
+        if( !( obj->kv_queue.as( x.rd )->data.flag & FLAG::KV_STATE_EDGE ) ){ edge=0; }}
+        if( x.wr!=nullptr ){ mask |= EPOLLOUT;
+        if( !( obj->kv_queue.as( x.wr )->data.flag & FLAG::KV_STATE_EDGE ) ){ edge=0; }}
+    return mask==0 ? 0 : mask | edge; }
+
+    int set_mask( int fd, int op, uint mask ) const noexcept {
+        EPOLLFD event; event.data.u64=0;
+        event.events = mask; event.data.fd = fd;
+        return epoll_ctl( obj->pd, op, fd, &event );
+    }
+
+    /*─······································································─*/
+
     void* append( kevent_t kv ) const noexcept {
 
-        if( kv.flag==0x00 || is_std( kv.fd ) ){ return nullptr; }
+        if( kv.flag==0x00 || kv.fd<0 || is_std( kv.fd ) ){ return nullptr; }
+
+        /* a direction that is already taken only stays taken if the fd is  *
+         * still registered, otherwise it belonged to a closed descriptor.  */
+
+        auto& x = get_kfd( kv.fd ); if( get_dir( x, kv.flag )!=nullptr ){
+        if( set_mask( kv.fd, EPOLL_CTL_MOD, x.mask )==0 ){ return nullptr; }
+            detach( x.rd ); detach( x.wr ); x.rd = x.wr = nullptr; x.mask = 0; }
 
-        auto tm = obj->kv_queue.as( get_nearest_timeout( kv.timeout ) );
-        /*-----*/ obj->kv_queue.insert( tm, kv );
-        auto id = tm==nullptr ? obj->kv_queue.last(): tm->prev;
+        /*-----*/ obj->kv_queue.push( kv ); auto id = obj->kv_queue.last();
+        get_dir( x, kv.flag ) = id; /*--------------------------------------*/
 
-        EPOLLFD event;
+        int op = x.mask==0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+        int c  = set_mask( kv.fd, op, get_mask( x ) );
 
-        event.events   = id->data.flag & FLAG::KV_STATE_READ 
-                       ? EPOLLIN : EPOLLOUT ;
-        event.events  |= id->data.flag & FLAG::KV_STATE_EDGE
-                       ? EPOLLET : 0x00 ;
-        event.data.fd  = id->data.fd;
-        event.data.ptr = id;
+        if( c!=0 && op==EPOLL_CTL_MOD && errno==ENOENT ){
+            get_dir( x, kv.flag ) = nullptr; detach( x.rd ); detach( x.wr );
+            x.rd = x.wr = nullptr; x.mask = 0; get_dir( x, kv.flag ) = id;
+            c  = set_mask( kv.fd, EPOLL_CTL_ADD, get_mask( x ) );
+        }
 
-        if( epoll_ctl( obj->pd, EPOLL_CTL_ADD, id->data.fd, &event )!=0 )
-          { obj->kv_queue.erase(id); return nullptr; }
+        if( c!=0 ){ get_dir( x, kv.flag ) = nullptr; obj->kv_queue.erase(id); return nullptr; }
+
+        x.mask = get_mask( x );
+        id->data.timer = kv.timeout==0 ? nullptr : obj->kv_timer.add( kv.timeout, id );
         
     return (void*)id; }
 
@@ -84,50 +135,67 @@ protected:
         if( ptr == nullptr ){ return -1; }
 
         auto kv = obj->kv_queue.as( ptr );
-        auto fl = kv->data.flag;
-        auto fd = kv->data.fd;
-
-        EPOLLFD event; event.data.fd=fd; event.events=0;
-        epoll_ctl( obj->pd, EPOLL_CTL_DEL, fd, &event );
+        if( kv->data.flag & FLAG::KV_STATE_ERASE ){ return release( kv ); }
+            kv->data.flag|= FLAG::KV_STATE_ERASE;
+
+        auto& x = get_kfd( kv->data.fd ); if( get_dir( x, kv->data.flag )==ptr ){
+              get_dir( x, kv->data.flag ) = nullptr; uint mask = get_mask( x );
+              set_mask( kv->data.fd, mask==0 ? EPOLL_CTL_DEL : EPOLL_CTL_MOD, mask );
+              x.mask = mask;
+        }
     
-    obj->kv_queue.erase(kv); return 0; }
+    obj->kv_timer.off( kv->data.timer ); kv->data.timer=nullptr; return release( kv ); }
 
-    /*─······································································─*/
-
-    void* get_nearest_timeout( ulong time ) const noexcept {
-        if( time == 0 ){ return nullptr; }
+    void dispatch( void* ptr ) const noexcept {
+        if( ptr==nullptr ){ return; } auto y = obj->kv_queue.as( ptr );
+        if( y->data.flag & FLAG::KV_STATE_USED ){ return; }
+            y->data.flag|= FLAG::KV_STATE_USED; ready_push( y );
+    }
 
-        auto x = obj->kv_queue.first(); while( x!=nullptr ){
-        if( 0   ==x->data.timeout ){ return x; }
-        if( time<=x->data.timeout ){ return x; }
-        x = x->next; }
+    void clear_fd() const noexcept {
+        for( ulong x=0; x<obj->kv_fd.size(); ++x ){
+        if ( obj->kv_fd[x].mask==0 ){ continue; }
+             set_mask( x, EPOLL_CTL_DEL, 0 );
+        }    obj->kv_fd.reset();
+    }
 
-    return nullptr; }
+    int release( void* ptr ) const noexcept {
+        auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & FLAG::KV_STATE_USED ){ return 0; }
+    obj->kv_queue.erase( kv ); return 0; }
 
     /*─······································································─*/
 
-    ptr_t<ETIMER> get_delay() const noexcept {
+    ETIMER* get_delay() const noexcept {
 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
-        ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
+        ulong time = TIMEOUT==0 ? !obj->tb.full : TIMEOUT;
+
+        long  tout = obj->kv_timer.get_delay(); /*-*/
 
         if(( tasks==0 && obj->kv_queue.size()>0 ) || 
            ( tasks==0 && obj.count()         >1 ) 
-        ) { return nullptr; }
+        ) { if( tout<0 ){ return nullptr; } time = tout; }
+        elif( tout>=0 ){ time = min( time, (ulong) tout ); }
 
-        ptr_t<ETIMER> ts( 0UL, ETIMER() );
-        
-        ts->tv_sec  =  time / 1000;
-        ts->tv_nsec = (time % 1000) * 1000000;
+        obj->ts.tv_sec  =  time / 1000;
+        obj->ts.tv_nsec = (time % 1000) * 1000000;
 
-    return ts; }
+    return &obj->ts; }
 
     int get_delay_ms() const noexcept { 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
-        ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
+        ulong time = TIMEOUT==0 ? !obj->tb.full : TIMEOUT;
+        long  tout = obj->kv_timer.get_delay(); /*-*/
         if(( tasks==0 && obj->kv_queue.size()>0 ) || 
            ( tasks==0 && obj.count()         >1 ) 
-        ) { return -1; } return time;
+        ) { return tout; } return tout<0 ? time : min( time, (ulong) tout );
+    }
+
+    /* one zero-timeout poll for busy_wait(): >0 events, 0 none, <0 error. */
+
+    int peek() const noexcept {
+        return obj->idx = epoll_wait( obj->pd, &obj->ev, obj->ev.size(), 0 );
     }
 
 protected:
@@ -135,8 +203,15 @@ protected:
     struct NODE {
         loop_t /*------*/ ev_queue;
         queue_t<kevent_t> kv_queue;
+        wheel_t /*-----*/ kv_timer;
         probe_t /*-----*/ probe;
-        ptr_t<EPOLLFD>    ev;
+        post_box_t /*--*/ post;
+        ptr_t<EPOLLFD>    ev; ETIMER ts;
+        ptr_t<kfd_t>      kv_fd;
+        void *kv_head=nullptr, *kv_tail=nullptr;
+        ulong kv_ready=0, kv_round=0;
+        busy_poll_t bp; task_budget_t tb;
+        NODEPP_STATS( loop_stats_t st; )
         int pd, ed, idx; 
         bool pl = true ;
     };  ptr_t<NODE> obj;
@@ -144,11 +219,12 @@ protected:
 public:
 
    ~kernel_t() noexcept { 
-        if( obj.count() > 1 ){ return; } 
+        if( obj.count() > 1 ){ return; } obj->post.close();
         close( obj->ed ); close( obj->pd ); 
     }
 
-    kernel_t() : obj( new NODE() ) {
+    kernel_t() : obj( ptr::make<NODE>() ) {
+        obj->kv_queue.set_slab( true );
         obj->ed = eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
         obj->pd = epoll_create1( EPOLL_CLOEXEC ); 
 
@@ -156,21 +232,19 @@ public:
       { throw except_t("Can't Initialize kernel_t"); }
         obj->ev.resize( MAX_PATH );
 
-        EPOLLFD event;
-        event.data.fd  = obj->ed; 
-        event.data.ptr = nullptr; 
-        event.events   = EPOLLIN;
-
-    if( epoll_ctl( obj->pd, EPOLL_CTL_ADD, obj->ed, &event )==-1 )
+    if( set_mask( obj->ed, EPOLL_CTL_ADD, EPOLLIN )==-1 )
       { throw except_t("Can't Initialize kernel_t"); }
 
+        int ed = obj->ed; obj->post.set_wake([=](){ uint64_t value=1;
+        return (int) ::write( ed,&value,sizeof(value) ); });
+
     }
 
 public:
 
-    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj.count()-1; }
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
 
-    void clear() const noexcept { /*--*/ obj->ev_queue.clear(); obj->kv_queue.clear(); obj->probe.clear(); }
+    void clear() const noexcept { ready_clear(); clear_fd(); obj->ev_queue.clear(); obj->kv_queue.clear(); obj->kv_timer.clear(); obj->probe.clear(); }
 
     bool empty() const noexcept { return size()==0; }
 
@@ -217,8 +291,29 @@ public:
 
     /*─······································································─*/
 
-    int emit() const noexcept { uint64_t value=1; 
-    return ::write(obj->ed,&value,sizeof(value)); }
+    void set_budget( ulong task, ulong time=0 ) const noexcept {
+         obj->tb.limit = obj->tb.task = task; obj->tb.time = time; 
+         obj->tb.count = 0; obj->tb.full = false;
+    }
+
+    task_budget_t get_budget() const noexcept { return obj->tb; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong time ) const noexcept { obj->bp.limit = obj->bp.budget = time; }
+
+    busy_poll_t get_busy_poll() const noexcept { return obj->bp; }
+
+    /*─······································································─*/
+
+    loop_stats_t get_stats() const noexcept {
+        auto out = obj->ev_queue.get_stats(); out.kv_queue = obj->kv_queue.size();
+        NODEPP_STATS( out.merge( obj->st ); )
+    return out; }
+
+    /*─······································································─*/
+
+    int emit() const noexcept { return obj->post.emit(); }
 
     /*─······································································─*/
 
@@ -237,53 +332,701 @@ public:
 
     inline int next() const {
 
-        while( obj->ev_queue.next() >= 0 ){ return 1; }
-        process::set_timeout(obj->ev_queue.get_delay());
-
-        auto stamp = process::now();
+        while( batch_next() ){ return 1; }
+        process::set_timeout( obj->kv_ready>0 ? 0 : obj->ev_queue.get_delay() );
 
-        do   { auto x=obj->kv_queue.first(); while( x != nullptr ){
-               auto y=x->next; if( x->data.timeout==0 ) { break; }
-        if   ( x->data.flag & TASK_STATE::USED ){ x=y; continue; }
-        if   ( x->data.timeout < stamp ){ remove(x); }
-        else { break; } x=y; }} while(0);
+        obj->kv_timer.next( process::now(), [&]( void* address ){
+            auto x = obj->kv_queue.as( address ); x->data.timer = nullptr;
+        if( x->data.flag & FLAG::KV_STATE_USED ){ x->data.flag |= FLAG::KV_STATE_CLOSED; }
+        else /*-------------------------------*/{ remove( x ); }
+        });
 
+        if( !busy_wait() ){
     #if   defined( SYS_epoll_pwait2 )
-        if( obj->pl ){ obj->idx=epoll_pwait2( obj->pd, &obj->ev, obj->ev.size(), &get_delay(), nullptr ); }
+        if( obj->pl ){ obj->idx=epoll_pwait2( obj->pd, &obj->ev, obj->ev.size(), get_delay(), nullptr ); }
         if( obj->idx==-1 && errno==ENOSYS ) { obj->pl = false; }
         if(!obj->pl ){ obj->idx=epoll_wait  ( obj->pd, &obj->ev, obj->ev.size(), get_delay_ms() ); }
     #else
         /*----------*/ obj->idx=epoll_wait  ( obj->pd, &obj->ev, obj->ev.size(), get_delay_ms() );
     #endif
+        }   process::get_clock( true );
+            NODEPP_STATS( ++obj->st.wakeup; obj->st.event += obj->idx>0 ? obj->idx : 0; )
+        busy_done( obj->idx>0 );
+        batch_done( obj->idx>0 );
 
     while( obj->idx > 0 ){ obj->idx--; auto x = obj->ev[ obj->idx ];
 
-        if( x.data.ptr==nullptr ){ uint64_t value=0; int c=0;
-            c=::read( obj->ed,&value, sizeof(value));
-        break; }
+        if( x.data.fd==obj->ed ){ uint64_t value=0;
+            if( ::read( obj->ed,&value,sizeof(value) )<0 ){ /*unused*/ }
+        post_next(); continue; }
 
-        auto y = obj->kv_queue.as( x.data.ptr );
-        if( !obj->kv_queue.is_valid( y ) ){ continue; }
+        auto& y = get_kfd( x.data.fd );
 
         if( x.events& ( EPOLLERR | EPOLLHUP ) &&
           ( x.events& ( EPOLLOUT | EPOLLIN ))==0
+        ) { remove( y.rd ); remove( y.wr ); continue; }
+
+        if( x.events& ( EPOLLIN  | EPOLLERR | EPOLLHUP ) ){ dispatch( y.rd ); }
+        if( x.events& ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ){ dispatch( y.wr ); }
+
+    } process::clear_timeout(); return 1; }
+
+};}
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifdef NODEPP_POLL_URING
+
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include "../loop.h"
+#include "../wheel.h"
+#include "../reactor.h"
+
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
+private:
+
+    friend class reactor_t<kernel_t>;
+
+    using URINGSQ = struct io_uring_sqe;
+    using URINGCQ = struct io_uring_cqe;
+    using ETIMER  = struct __kernel_timespec;
+
+    enum FLAG { 
+         KV_STATE_UNKNONW = 0b00000000, 
+         KV_STATE_WRITE   = 0b00000001,
+         KV_STATE_READ    = 0b00000010,
+         KV_STATE_EDGE    = 0b10000000,
+         KV_STATE_USED    = 0b00000100,
+         KV_STATE_AWAIT   = 0b00001100,
+         KV_STATE_CLOSED  = 0b00001000,
+         KV_STATE_ARMED   = 0b00010000,
+         KV_STATE_ERASE   = 0b00100000,
+         KV_STATE_FEED    = 0b01000000
+    };
+
+    enum DATA {
+         URING_NONE   = 0,
+         URING_EMIT   = 1,
+         URING_RECV   = 2,
+         URING_ACCEPT = 3
+    };
+
+    enum FEED {
+         FEED_NONE   = 0b00000000,
+         FEED_RECV   = 0b00000001,
+         FEED_ACCEPT = 0b00000010,
+         FEED_ARMED  = 0b00000100,
+         FEED_DONE   = 0b00001000
+    };
+
+    enum BUFF {
+         BUFF_COUNT = 256,
+         BUFF_MASK  = 255,
+         BUFF_SIZE  = 4096,
+         BUFF_GROUP = 0
+    };
+
+    struct kevent_t { public:
+        function_t<int> callback; void* timer; void* ready;
+        ulong timeout; int fd, flag; 
+    };
+
+    /* kfeed_t is indexed by fd. head/tail chain the staged buffer ids of *
+     * a recv feed, or the accepted fds of an accept feed, linked through *
+     * the link field of their own slots. kbuff_t is indexed by buffer id.*/
+
+    struct kfeed_t { void* rd; int head, tail, link, res; uint gen, mask; };
+    struct kbuff_t { int next; uint off, len; };
+
+    bool is_std( int fd ) const noexcept { 
+        return fd == STDOUT_FILENO ||
+               fd == STDIN_FILENO  ||
+               fd == STDERR_FILENO ;
+    }
+
+protected:
+
+    /* submissions are only queued here, the kernel picks them up in the     *
+     * single io_uring_enter() that next() issues once per loop iteration.   */
+
+    int enter( uint wait, uint flag, void* arg, ulong size ) const noexcept {
+        uint submit = *obj->sq_tail - __atomic_load_n( obj->sq_head, __ATOMIC_ACQUIRE );
+        return syscall( __NR_io_uring_enter, obj->pd, submit, wait, flag, arg, size );
+    }
+
+    URINGSQ* get_sqe() const noexcept { uint x=0;
+        while( *obj->sq_tail - __atomic_load_n( obj->sq_head, __ATOMIC_ACQUIRE ) >= obj->sq_size ){
+        if   ( x++ > 3 ){ return nullptr; } enter( 0, 0, nullptr, 0 ); }
+        URINGSQ* sqe = &obj->sqe[ *obj->sq_tail & *obj->sq_mask ];
+        memset( sqe, 0, sizeof( URINGSQ ) ); return sqe;
+    }
+
+    void push_sqe() const noexcept {
+        __atomic_store_n( obj->sq_tail, *obj->sq_tail+1, __ATOMIC_RELEASE );
+    }
+
+    /*─······································································─*/
+
+    /* edge registrations use a multishot poll, level ones are one-shot and *
+     * re-armed once their callback runs out of data; either way a kv node   *
+     * is only released after its final cqe ( no IORING_CQE_F_MORE ) lands. */
+
+    bool arm( void* ptr ) const noexcept {
+        auto kv  = obj->kv_queue.as( ptr );
+        auto sqe = get_sqe(); if( sqe==nullptr ){ return false; }
+
+        sqe->opcode        = IORING_OP_POLL_ADD;
+        sqe->fd            = kv->data.fd;
+        sqe->poll32_events = kv->data.flag & FLAG::KV_STATE_READ 
+                           ? POLLIN : POLLOUT ;
+        sqe->len           = kv->data.flag & FLAG::KV_STATE_EDGE
+                           ? IORING_POLL_ADD_MULTI : 0x00 ;
+        sqe->user_data     = (ulong) ptr;
+
+    push_sqe(); kv->data.flag |= FLAG::KV_STATE_ARMED; return true; }
+
+    bool wait_emit() const noexcept {
+        auto sqe = get_sqe(); if( sqe==nullptr ){ return false; }
+
+        sqe->opcode    = IORING_OP_READ;
+        sqe->fd        = obj->ed;
+        sqe->addr      = (ulong) &obj->value;
+        sqe->len       = sizeof( obj->value );
+        sqe->user_data = DATA::URING_EMIT;
+
+    push_sqe(); return true; }
+
+    int release( void* ptr ) const noexcept {
+        auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & ( FLAG::KV_STATE_ARMED | FLAG::KV_STATE_USED ) )
+          { return 0; } obj->kv_queue.erase( kv ); return 0;
+    }
+
+    /* polls are one-shot unless edge triggered: a callback that went back *
+     * to waiting needs a fresh POLL_ADD, or a retry if the ring is full.  */
+
+    bool rearm( void* ptr ) const noexcept {
+        auto kv = obj->kv_queue.as( ptr ); if( kv->data.flag & FLAG::KV_STATE_FEED )
+      { return !feed_ready( obj->kv_feed[ kv->data.fd ] ); }
+        if( kv->data.flag & FLAG::KV_STATE_ARMED ){ return true; }
+    return arm( ptr ); }
+
+    /*─······································································─*/
+
+    /* a fed fd keeps one multishot ACCEPT or RECV in flight. Received    *
+     * bytes land in the provided buffer ring and stay staged there until *
+     * feed_read() copies them out, accepted fds wait for feed_accept().  *
+     * A read poll on a fed fd never reaches the ring: it is woken by the *
+     * feed completions themselves. The generation in user_data lets the *
+     * completions of a cancelled feed be told apart once fd is reused.   */
+
+    kfeed_t* find_feed( int fd ) const noexcept {
+        return (ulong) fd < obj->kv_feed.size() ? &obj->kv_feed[ fd ] : nullptr;
+    }
+
+    kfeed_t& get_feed( int fd ) const noexcept {
+        if( (ulong) fd >= obj->kv_feed.size() ){
+            ptr_t<kfeed_t> n_buffer ( max( (ulong) fd+1, obj->kv_feed.size()*2 ), kfeed_t({ nullptr, -1, -1, -1, 0, 0, 0 }) );
+            for( ulong x=0; x<obj->kv_feed.size(); ++x ){ n_buffer[x] = obj->kv_feed[x]; }
+            obj->kv_feed = n_buffer;
+        }   return obj->kv_feed[ fd ];
+    }
+
+    ulong feed_id( int fd, const kfeed_t& x ) const noexcept {
+        return (ulong) fd << 32 | (ulong)( x.gen & 0xFFFFFF ) << 8 |
+             ( x.mask & FEED::FEED_ACCEPT ? DATA::URING_ACCEPT : DATA::URING_RECV );
+    }
+
+    bool feed_ready( const kfeed_t& x ) const noexcept {
+        return x.head>=0 || !( x.mask & FEED::FEED_ARMED );
+    }
+
+    void feed_wake( kfeed_t& x ) const noexcept {
+        if( x.rd==nullptr ){ return; } auto kv = obj->kv_queue.as( x.rd );
+        if( kv->data.flag & FLAG::KV_STATE_USED ){ return; }
+            kv->data.flag|= FLAG::KV_STATE_USED; ready_push( kv );
+    }
+
+    bool feed_arm( int fd ) const noexcept {
+        auto& x = obj->kv_feed[ fd ];
+        auto sqe = get_sqe(); if( sqe==nullptr ){ return false; }
+
+        if( x.mask & FEED::FEED_ACCEPT ){
+        sqe->opcode       = IORING_OP_ACCEPT;
+        sqe->ioprio       = IORING_ACCEPT_MULTISHOT;
+        sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+        } else {
+        sqe->opcode       = IORING_OP_RECV;
+        sqe->ioprio       = IORING_RECV_MULTISHOT;
+        sqe->flags        = IOSQE_BUFFER_SELECT;
+        sqe->buf_group    = BUFF::BUFF_GROUP;
+        }
+
+        sqe->fd           = fd;
+        sqe->user_data    = feed_id( fd, x );
+
+    push_sqe(); x.mask |= FEED::FEED_ARMED; return true; }
+
+    /* the ring is addressed as a plain io_uring_buf array: the tail is *
+     * the resv field of entry 0, and the flex array of io_uring_buf_ring *
+     * does not start at offset 0 once compiled as C++.                  */
+
+    void buff_push( uint bid ) const noexcept {
+        auto& y = obj->br[ obj->br_tail & BUFF::BUFF_MASK ];
+        y.addr = (ulong)( obj->bf + bid * BUFF::BUFF_SIZE );
+        y.len  = BUFF::BUFF_SIZE; y.bid = bid;
+        __atomic_store_n( &obj->br[0].resv, ++obj->br_tail, __ATOMIC_RELEASE );
+    }
+
+    /* hands staged buffers back to the ring, closes accepted fds nobody *
+     * took and cancels the multishot request; its last completions are *
+     * dropped by generation.                                            */
+
+    void feed_drop( int fd ) const noexcept { auto& x = obj->kv_feed[ fd ];
+
+        if( x.mask & FEED::FEED_ARMED ){
+            auto sqe = get_sqe(); if( sqe!=nullptr ){
+            sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+            sqe->addr      = feed_id( fd, x );
+            sqe->user_data = DATA::URING_NONE; push_sqe(); }
+        }
+
+        if( x.mask & FEED::FEED_ACCEPT ){
+        while( x.head>=0 ){ int n = obj->kv_feed[ x.head ].link; ::close( x.head ); x.head = n; }
+        } else {
+        while( x.head>=0 ){ int n = obj->kv_buff[ x.head ].next; buff_push( x.head ); x.head = n; }
+        }
+
+        x.mask = FEED::FEED_NONE; x.tail = -1; x.rd = nullptr;
+    }
+
+    /* the running kernel rejected a multishot op: the feed is switched  *
+     * off for this loop and its waiting reader goes back to a poll.     */
+
+    void feed_fail( int fd ) const noexcept {
+        auto rd = obj->kv_feed[ fd ].rd; feed_drop( fd ); obj->feed = false;
+        if( rd==nullptr ){ return; } auto kv = obj->kv_queue.as( rd );
+            kv->data.flag &=~ FLAG::KV_STATE_FEED;
+        if( kv->data.flag & FLAG::KV_STATE_USED ){ return; } 
+        if( !arm( kv ) ){ remove( kv ); }
+    }
+
+    void feed_done( const URINGCQ& x ) const noexcept {
+        int   fd  = x.user_data >> 32; uint gen = x.user_data >> 8 & 0xFFFFFF;
+        bool  acc = ( x.user_data & 0xFF ) == DATA::URING_ACCEPT;
+        bool  buf = x.flags & IORING_CQE_F_BUFFER;
+        uint  bid = x.flags >> IORING_CQE_BUFFER_SHIFT;
+
+        if( acc && x.res>=0 ){ get_feed( x.res ).link = -1; }
+        auto y = find_feed( fd ); if( y==nullptr || !( y->mask & ( acc ? FEED::FEED_ACCEPT : FEED::FEED_RECV ) ) 
+                                                 || ( y->gen & 0xFFFFFF ) != gen ){
+            if( buf ) /*----*/ { buff_push( bid ); }
+            if( acc && x.res>=0 ){ ::close( x.res ); }
+        return; }
+
+        if( !( x.flags & IORING_CQE_F_MORE ) ){ y->mask &=~ FEED::FEED_ARMED; }
+        if( x.res==-EINVAL && y->head<0 ){ feed_fail( fd ); return; }
+
+        if( acc && x.res>=0 ){
+            if( y->tail<0 ){ y->head = x.res; } 
+            else { obj->kv_feed[ y->tail ].link = x.res; } y->tail = x.res;
+        } elif( !acc && x.res>0 && buf ){
+            auto& z = obj->kv_buff[ bid ]; z.next = -1; z.off = 0; z.len = x.res;
+            if( y->tail<0 ){ y->head = bid; } 
+            else { obj->kv_buff[ y->tail ].next = bid; } y->tail = bid;
+        } elif( !acc && x.res!=-ENOBUFS ){
+            if( buf ){ buff_push( bid ); } y->mask |= FEED::FEED_DONE; y->res = x.res;
+        }
+
+    feed_wake( *y ); }
+
+    /* reaps whatever completions are already visible, without entering *
+     * the kernel; feed readers call it before reporting nothing staged. */
+
+    void reap() const noexcept {
+        uint head = *obj->cq_head;
+        uint tail = __atomic_load_n( obj->cq_tail, __ATOMIC_ACQUIRE );
+
+    while( head != tail ){ auto x = obj->cqe[ head & *obj->cq_mask ];
+        __atomic_store_n( obj->cq_head, ++head, __ATOMIC_RELEASE );
+
+        if( x.user_data==DATA::URING_NONE ){ continue; }
+        if( x.user_data==DATA::URING_EMIT ){ wait_emit(); post_next(); continue; }
+
+        if(( x.user_data & 0xFF )==DATA::URING_RECV   ||
+           ( x.user_data & 0xFF )==DATA::URING_ACCEPT 
+        ) { feed_done( x ); continue; }
+
+        auto y = obj->kv_queue.as( (void*) x.user_data );
+        if( !( x.flags & IORING_CQE_F_MORE ) ){ y->data.flag &=~ FLAG::KV_STATE_ARMED; }
+
+        if( y->data.flag & FLAG::KV_STATE_ERASE ){ release( y ); continue; }
+
+        if( x.res < 0 || ( x.res & ( POLLERR | POLLHUP ) &&
+          ( x.res & ( POLLOUT | POLLIN ))==0 )
         ) { remove( y ); continue; }
 
         if( y->data.flag & FLAG::KV_STATE_USED ){ continue; }
-            y->data.flag|= FLAG::KV_STATE_USED;
+            y->data.flag|= FLAG::KV_STATE_USED; ready_push( y );
+
+    }}
 
-        obj->ev_queue.add( coroutine::add( COROUTINE(){
-        coBegin
+    /*─······································································─*/
 
-            do { switch( y->data.callback() ) {
-            case -1: remove(y); /*----------------------*/ coEnd; break;
-            case  0: y->data.flag &=~ FLAG::KV_STATE_USED; coEnd; break;
-            case  1: break; } coNext; } while(1);
+    void* append( kevent_t kv ) const noexcept {
 
-        coFinish
-        }));
+        if( kv.flag==0x00 || is_std( kv.fd ) ){ return nullptr; }
 
-    } process::clear_timeout(); return 1; }
+        auto x = kv.flag & FLAG::KV_STATE_READ ? find_feed( kv.fd ) : nullptr;
+        if ( x!=nullptr && x->mask==FEED::FEED_NONE ){ x = nullptr; }
+        if ( x!=nullptr && x->rd  !=nullptr ) /*--*/ { return nullptr; }
+
+        /*-----*/ obj->kv_queue.push( kv ); auto id = obj->kv_queue.last();
+        id->data.timer = kv.timeout==0 ? nullptr : obj->kv_timer.add( kv.timeout, id );
+
+        if( x!=nullptr ){ x->rd = id; id->data.flag |= FLAG::KV_STATE_FEED;
+        if( feed_ready( *x ) ){ id->data.flag |= FLAG::KV_STATE_USED; ready_push( id ); }
+        return (void*)id; }
+
+        if( !arm( id ) )
+          { obj->kv_timer.off( id->data.timer ); obj->kv_queue.erase(id); return nullptr; }
+        
+    return (void*)id; }
+
+    int remove( void* ptr ) const noexcept {
+        if( ptr == nullptr ){ return -1; }
+
+        auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & FLAG::KV_STATE_ERASE ){ return release( kv ); }
+            kv->data.flag|= FLAG::KV_STATE_ERASE;
+
+        obj->kv_timer.off( kv->data.timer ); kv->data.timer = nullptr;
+
+        if( kv->data.flag & FLAG::KV_STATE_FEED ){ 
+            auto x = find_feed( kv->data.fd ); if( x!=nullptr && x->rd==ptr ){ x->rd = nullptr; }
+        }
+
+        if( kv->data.flag & FLAG::KV_STATE_ARMED ){
+            auto sqe = get_sqe(); if( sqe!=nullptr ){
+            sqe->opcode    = IORING_OP_POLL_REMOVE;
+            sqe->addr      = (ulong) ptr;
+            sqe->user_data = DATA::URING_NONE; push_sqe(); }
+        }
+    
+    return release( kv ); }
+
+    /*─······································································─*/
+
+    ETIMER* get_delay() const noexcept {
+
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
+        ulong time = TIMEOUT==0 ? !obj->tb.full : TIMEOUT;
+
+        long  tout = obj->kv_timer.get_delay(); /*-*/
+
+        if(( tasks==0 && obj->kv_queue.size()>0 ) || 
+           ( tasks==0 && obj.count()         >1 ) 
+        ) { if( tout<0 ){ return nullptr; } time = tout; }
+        elif( tout>=0 ){ time = min( time, (ulong) tout ); }
+
+        obj->ts.tv_sec  =  time / 1000;
+        obj->ts.tv_nsec = (time % 1000) * 1000000;
+
+    return &obj->ts; }
+
+    int get_delay_ms() const noexcept { if( get_delay()==nullptr ){ return -1; }
+        return obj->ts.tv_sec*1000 + obj->ts.tv_nsec/1000000;
+    }
+
+    /* one zero-timeout poll for busy_wait(): 1 if completions are queued. */
+
+    int peek() const noexcept { enter( 0, IORING_ENTER_GETEVENTS, nullptr, 0 );
+        return *obj->cq_head != __atomic_load_n( obj->cq_tail, __ATOMIC_ACQUIRE );
+    }
+
+protected:
+
+    struct NODE {
+        loop_t /*------*/ ev_queue;
+        queue_t<kevent_t> kv_queue;
+        wheel_t /*-----*/ kv_timer;
+        probe_t /*-----*/ probe;
+        post_box_t /*--*/ post;
+        ptr_t<kfeed_t>    kv_feed;
+        ptr_t<kbuff_t>    kv_buff;
+        URINGSQ* sqe; URINGCQ* cqe; ETIMER ts;
+        uint *sq_head, *sq_tail, *sq_mask;
+        uint *cq_head, *cq_tail, *cq_mask;
+        void *sq_ptr=MAP_FAILED, *cq_ptr=MAP_FAILED;
+        ulong sq_len=0, cq_len=0, sq_size=0;
+        void *kv_head=nullptr, *kv_tail=nullptr;
+        ulong kv_ready=0, kv_round=0;
+        busy_poll_t bp; task_budget_t tb;
+        NODEPP_STATS( loop_stats_t st; )
+        struct io_uring_buf* br=(struct io_uring_buf*) MAP_FAILED;
+        char* bf=nullptr; ushort br_tail=0; bool feed=false;
+        uint64_t value=0; int pd=-1, ed=-1;
+    };  ptr_t<NODE> obj;
+
+public:
+
+   ~kernel_t() noexcept { 
+        if( obj.count() > 1 ){ return; } obj->post.close();
+        if( obj->cq_ptr != obj->sq_ptr && obj->cq_ptr != MAP_FAILED ){ munmap( obj->cq_ptr, obj->cq_len ); }
+        if( obj->sq_ptr != MAP_FAILED ){ munmap( obj->sq_ptr, obj->sq_len ); }
+        if( obj->sqe    != MAP_FAILED ){ munmap( obj->sqe, obj->sq_size*sizeof(URINGSQ) ); }
+        for( ulong x=0; x<obj->kv_feed.size(); ++x ){ if( obj->kv_feed[x].mask & FEED::FEED_ACCEPT ){
+        for( int y=obj->kv_feed[x].head; y>=0; y=obj->kv_feed[y].link ){ ::close( y ); } }}
+        close( obj->ed ); close( obj->pd ); 
+        if( obj->br     != MAP_FAILED ){ munmap( obj->br, BUFF::BUFF_COUNT*( sizeof(struct io_uring_buf)+BUFF::BUFF_SIZE ) ); }
+    }
+
+    kernel_t() : obj( ptr::make<NODE>() ) {
+        obj->kv_queue.set_slab( true );
+        struct io_uring_params par; memset( &par, 0, sizeof( par ) );
+
+        obj->ed = eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+        obj->pd = syscall( __NR_io_uring_setup, MAX_PATH, &par ); 
+
+    if( obj->pd==-1 || obj->ed==-1 || !( par.features & IORING_FEAT_EXT_ARG ) )
+      { throw except_t("Can't Initialize kernel_t"); }
+
+        obj->sq_size = par.sq_entries;
+        obj->sq_len  = par.sq_off.array + par.sq_entries * sizeof( uint );
+        obj->cq_len  = par.cq_off.cqes  + par.cq_entries * sizeof( URINGCQ );
+
+        if( par.features & IORING_FEAT_SINGLE_MMAP )
+          { obj->sq_len = obj->cq_len = max( obj->sq_len, obj->cq_len ); }
+
+        obj->sq_ptr = mmap( 0, obj->sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, obj->pd, IORING_OFF_SQ_RING );
+        obj->cq_ptr = par.features & IORING_FEAT_SINGLE_MMAP ? obj->sq_ptr :
+                      mmap( 0, obj->cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, obj->pd, IORING_OFF_CQ_RING );
+        obj->sqe    = (URINGSQ*) mmap( 0, obj->sq_size*sizeof(URINGSQ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, obj->pd, IORING_OFF_SQES );
+
+    if( obj->sq_ptr==MAP_FAILED || obj->cq_ptr==MAP_FAILED || obj->sqe==MAP_FAILED )
+      { throw except_t("Can't Initialize kernel_t"); }
+
+        char* sq = (char*) obj->sq_ptr; char* cq = (char*) obj->cq_ptr;
+        obj->sq_head = (uint*)( sq + par.sq_off.head ); obj->cq_head = (uint*)( cq + par.cq_off.head );
+        obj->sq_tail = (uint*)( sq + par.sq_off.tail ); obj->cq_tail = (uint*)( cq + par.cq_off.tail );
+        obj->sq_mask = (uint*)( sq + par.sq_off.ring_mask ); 
+        obj->cq_mask = (uint*)( cq + par.cq_off.ring_mask );
+        obj->cqe     = (URINGCQ*)( cq + par.cq_off.cqes );
+
+        uint* array  = (uint*)( sq + par.sq_off.array );
+        for( uint x=0; x<obj->sq_size; ++x ){ array[x]=x; }
+
+    if( !wait_emit() )
+      { throw except_t("Can't Initialize kernel_t"); }
+
+        int ed = obj->ed; obj->post.set_wake([=](){ uint64_t value=1;
+        return (int) ::write( ed,&value,sizeof(value) ); });
+
+        /* the buffer ring is optional: without it ( Linux < 5.19 ) no fd  *
+         * is ever fed and sockets keep polling and calling recv().        */
+
+        obj->br = (struct io_uring_buf*) mmap( 0, BUFF::BUFF_COUNT*( sizeof(struct io_uring_buf)+BUFF::BUFF_SIZE ), 
+                  PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if( obj->br==MAP_FAILED ){ return; }
+
+        struct io_uring_buf_reg reg; memset( &reg, 0, sizeof( reg ) );
+        reg.ring_addr    = (ulong) obj->br;
+        reg.ring_entries = BUFF::BUFF_COUNT;
+        reg.bgid         = BUFF::BUFF_GROUP;
+
+        if( syscall( __NR_io_uring_register, obj->pd, IORING_REGISTER_PBUF_RING, &reg, 1 )!=0 ){ return; }
+
+        obj->bf   = (char*) obj->br + BUFF::BUFF_COUNT*sizeof(struct io_uring_buf);
+        obj->kv_buff = ptr_t<kbuff_t>( BUFF::BUFF_COUNT, kbuff_t({ -1, 0, 0 }) );
+        for( uint x=0; x<BUFF::BUFF_COUNT; ++x ){ buff_push( x ); } obj->feed = true;
+
+    }
+
+public:
+
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
+
+    void clear() const noexcept { ready_clear(); obj->ev_queue.clear(); obj->kv_timer.clear(); obj->probe.clear();
+        auto x = obj->kv_queue.first(); while( x!=nullptr ){ auto n = x->next;
+             x->data.flag &=~ FLAG::KV_STATE_USED; remove( x ); x = n; }
+    }
+
+    bool empty() const noexcept { return size()==0; }
+
+    /*─······································································─*/
+
+    void off( ptr_t<task_t> address ) const noexcept { clear( address ); }
+
+    void clear( ptr_t<task_t> address ) const noexcept {
+        if( address.null() ) /*-*/ { return; }
+        if( address->sign == &obj ){
+        if( address->flag & TASK_STATE::CLOSED ){ return; }
+            address->flag = TASK_STATE::CLOSED;
+            remove( address->addr ); 
+        } else { obj->ev_queue.off( address ); }
+    }
+
+    /*─······································································─*/
+
+    template< class T, class U, class... W >
+    ptr_t<task_t> poll_add( T& inp, int flag, U cb, ulong timeout=0, const W&... args ) noexcept {
+        if( cb( args... )==-1 ){ return nullptr; }
+    
+        kevent_t      kv;
+        kv.flag     = flag;
+        kv.fd       = inp.get_fd(); auto clb = type::bind( cb );
+        kv.timeout  = timeout==0 ? 0 : process::now() + timeout;
+        
+        kv.callback = [=](){ int c=(*clb)( args... );
+            if( inp.is_closed () ){ return -1; } 
+            if( inp.is_waiting() ){ return  0; }
+        return c; };
+
+        ptr_t<task_t> task( 0UL, task_t() );
+        task->flag  = TASK_STATE::OPEN;
+        task->addr  = append( kv ); 
+        task->sign  = &obj;
+
+    return task->addr==nullptr ? loop_add( cb, args... ) : task; }
+
+    template< class... T >
+    ptr_t<task_t> loop_add( const T&... args ) noexcept {
+        return obj->ev_queue.add( args... );
+    }
+
+    /*─······································································─*/
+
+    void set_budget( ulong task, ulong time=0 ) const noexcept {
+         obj->tb.limit = obj->tb.task = task; obj->tb.time = time; 
+         obj->tb.count = 0; obj->tb.full = false;
+    }
+
+    task_budget_t get_budget() const noexcept { return obj->tb; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong time ) const noexcept { obj->bp.limit = obj->bp.budget = time; }
+
+    busy_poll_t get_busy_poll() const noexcept { return obj->bp; }
+
+    /*─······································································─*/
+
+    loop_stats_t get_stats() const noexcept {
+        auto out = obj->ev_queue.get_stats(); out.kv_queue = obj->kv_queue.size();
+        NODEPP_STATS( out.merge( obj->st ); )
+    return out; }
+
+    /*─······································································─*/
+
+    int emit() const noexcept { return obj->post.emit(); }
+
+    /*─······································································─*/
+
+    /* see reactor_t::feed_add(); srv picks a multishot accept over recv. */
+
+    int feed_add( int fd, bool srv ) const noexcept {
+        if( !obj->feed || fd<0 || is_std( fd ) ){ return -1; }
+        auto& x = get_feed( fd ); if( x.mask!=FEED::FEED_NONE ){ feed_off( fd ); }
+
+        x.mask = srv ? FEED::FEED_ACCEPT : FEED::FEED_RECV;
+        x.head = x.tail = -1; x.res = 0; ++x.gen;
+
+        if( !feed_arm( fd ) ){ x.mask = FEED::FEED_NONE; return -1; }
+    return 1; }
+
+    /* sockets freed along with the loop's own queues land here while obj *
+     * is already torn down; the ring is gone by then, nothing to cancel. */
+
+    int feed_off( int fd ) const noexcept { if( obj.null() ){ return -1; }
+        auto x = find_feed( fd ); if( x==nullptr || x->mask==FEED::FEED_NONE ){ return -1; }
+        auto rd = x->rd; feed_drop( fd ); if( rd==nullptr ){ return 1; }
+        auto kv = obj->kv_queue.as( rd ); kv->data.flag &=~ FLAG::KV_STATE_FEED;
+        if( !( kv->data.flag & FLAG::KV_STATE_USED ) ){ remove( kv ); }
+    return 1; }
+
+    /* >=0 an accepted fd, -2 none staged yet, -3 not fed. */
+
+    int feed_accept( int fd ) const noexcept {
+        auto x = find_feed( fd ); if( x==nullptr || !( x->mask & FEED::FEED_ACCEPT ) ){ return -3; }
+        if ( x->head<0 ){ reap(); x = find_feed( fd );
+        if ( !( x->mask & FEED::FEED_ACCEPT ) ){ return -3; }}
+
+        if ( x->head>=0 ){ int c = x->head; x->head = obj->kv_feed[ c ].link;
+        if ( x->head< 0 ){ x->tail = -1; } return c; }
+
+        if( !( x->mask & FEED::FEED_ARMED ) ){ feed_arm( fd ); }
+    return -2; }
+
+    /* >0 bytes copied, 0 eof, -1 error, -2 none staged yet, -3 not fed. */
+
+    int feed_read( int fd, char* bf, ulong sx ) const noexcept {
+        auto x = find_feed( fd ); if( x==nullptr || !( x->mask & FEED::FEED_RECV ) ){ return -3; }
+        if ( x->head<0 ){ reap(); x = find_feed( fd );
+        if ( !( x->mask & FEED::FEED_RECV ) ){ return -3; }}
+
+        ulong len=0; while( x->head>=0 && len<sx ){
+            auto& y = obj->kv_buff[ x->head ]; ulong z = min( sx-len, (ulong) y.len );
+            memcpy( bf+len, obj->bf + x->head*BUFF::BUFF_SIZE + y.off, z ); 
+            len+= z; y.off+= z; y.len-= z; if( y.len>0 ){ break; }
+            int n = y.next; buff_push( x->head ); x->head = n;
+        }   if( x->head<0 ){ x->tail = -1; } if( len>0 ){ return len; }
+
+        if( x->mask & FEED::FEED_DONE ){ return x->res==0 ? 0 : -1; }
+        if( x->mask & FEED::FEED_ARMED ){ return -2; }
+
+        /* ENOBUFS stopped the recv: re-armed and submitted right away, *
+         * as a reader spinning on read() may not reach next() soon.   */
+
+        if( feed_arm( fd ) ){ enter( 0, 0, nullptr, 0 ); }
+    return -2; }
+
+    /*─······································································─*/
+
+    template< class T, class... V > 
+    int await( T cb, const V&... args ) const { 
+    int c=0; probe_t tmp = obj->probe;
+
+        if ((c =cb(args...))>=0 ){
+        if ( c==1 ){ auto t = coroutine::getno().delay;
+        if ( t >0 ){ process::set_timeout( t ); }
+        else /*-*/ { process::set_timeout(0UL); }} next(); return 1; } 
+    
+    return -1; }
+
+    /*─······································································─*/
+
+    inline int next() const {
+
+        while( batch_next() ){ return 1; }
+        process::set_timeout( obj->kv_ready>0 ? 0 : obj->ev_queue.get_delay() );
+
+        obj->kv_timer.next( process::now(), [&]( void* address ){
+            auto x = obj->kv_queue.as( address ); x->data.timer = nullptr;
+        if( x->data.flag & FLAG::KV_STATE_USED ){ x->data.flag |= FLAG::KV_STATE_CLOSED; }
+        else /*-------------------------------*/{ remove( x ); }
+        });
+
+        if( !busy_wait() ){
+        struct io_uring_getevents_arg arg; memset( &arg, 0, sizeof( arg ) );
+        arg.ts = (ulong) get_delay();
+
+        enter( 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof( arg ) );
+        }   process::get_clock( true );
+
+        uint head = *obj->cq_head;
+        uint tail = __atomic_load_n( obj->cq_tail, __ATOMIC_ACQUIRE );
+        NODEPP_STATS( ++obj->st.wakeup; obj->st.event += tail - head; )
+        busy_done( tail != head );
+        batch_done( tail != head );
+
+    reap(); process::clear_timeout(); return 1; }
 
 };}
 
@@ -296,10 +1039,14 @@ public:
 #include <sys/types.h>
 #include <sys/event.h>
 #include "../loop.h"
+#include "../wheel.h"
+#include "../reactor.h"
 
-namespace nodepp { class kernel_t {
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
 private:
 
+    friend class reactor_t<kernel_t>;
+
     using KTIMER  = struct timespec;
     using KPOLLFD = struct kevent;
 
@@ -310,14 +1057,17 @@ private:
          KV_STATE_EDGE    = 0b10000000,
          KV_STATE_USED    = 0b00000100,
          KV_STATE_AWAIT   = 0b00001100,
-         KV_STATE_CLOSED  = 0b00001000
+         KV_STATE_CLOSED  = 0b00001000,
+         KV_STATE_ERASE   = 0b00100000
     };
 
     struct kevent_t { public:
-        function_t<int> callback;
+        function_t<int> callback; void* timer; void* ready;
         ulong timeout; int fd, flag; 
     };
 
+    struct kfd_t { void* rd; void* wr; uint mask; };
+
     bool is_std( int fd ) const noexcept { 
         return fd == STDOUT_FILENO ||
                fd == STDIN_FILENO  ||
@@ -326,13 +1076,41 @@ private:
 
 protected:
 
+    /* read and write filters of one fd are separate knotes, the fd table  *
+     * tracks their owners so a second poll on the same filter falls back  *
+     * instead of overwriting the udata of the first one.                  */
+
+    kfd_t& get_kfd( int fd ) const noexcept {
+        if( (ulong) fd >= obj->kv_fd.size() ){
+            ptr_t<kfd_t> n_buffer ( max( (ulong) fd+1, obj->kv_fd.size()*2 ), kfd_t({ nullptr, nullptr, 0 }) );
+            for( ulong x=0; x<obj->kv_fd.size(); ++x ){ n_buffer[x] = obj->kv_fd[x]; }
+            obj->kv_fd = n_buffer;
+        }   return obj->kv_fd[ fd ];
+    }
+
+    void*& get_dir( kfd_t& x, int flag ) const noexcept {
+        return flag & FLAG::KV_STATE_READ ? x.rd : x.wr;
+    }
+
+    bool is_alive( int fd, int fl ) const noexcept {
+        KPOLLFD event, out;
+        EV_SET( &event, fd, fl, EV_ENABLE | EV_RECEIPT, 0, 0, NULL );
+        if( kevent( obj->pd, &event, 1, &out, 1, NULL )!=1 ){ return false; }
+        return !( out.flags & EV_ERROR ) || out.data==0;
+    }
+
+    /*─······································································─*/
+
     void* append( kevent_t kv ) const noexcept {
 
-        if( kv.flag==0x00 || is_std( kv.fd ) ){ return nullptr; }
+        if( kv.flag==0x00 || kv.fd<0 || is_std( kv.fd ) ){ return nullptr; }
+
+        auto& x = get_kfd( kv.fd ); if( get_dir( x, kv.flag )!=nullptr ){
+        if( is_alive( kv.fd, kv.flag & FLAG::KV_STATE_READ ? EVFILT_READ : EVFILT_WRITE ) )
+          { return nullptr; } detach( get_dir( x, kv.flag ) ); get_dir( x, kv.flag ) = nullptr; }
 
-        auto tm = obj->kv_queue.as( get_nearest_timeout( kv.timeout ) );
-        /*-----*/ obj->kv_queue.insert( tm, kv );
-        auto id = tm==nullptr ? obj->kv_queue.last(): tm->prev;
+        /*-----*/ obj->kv_queue.push( kv ); auto id = obj->kv_queue.last();
+        id->data.timer = kv.timeout==0 ? nullptr : obj->kv_timer.add( kv.timeout, id );
 
         KPOLLFD event;
 
@@ -347,60 +1125,66 @@ protected:
         EV_SET( &event, fd, fl, fc, 0, 0, (void*) id );
 
         if( kevent( obj->pd, &event, 1, NULL, 0, NULL ) !=0 )
-          { obj->kv_queue.erase(id); /*--*/ return nullptr; }
+          { obj->kv_timer.off( id->data.timer ); obj->kv_queue.erase(id); return nullptr; }
         
-    return (void*) id; }
+    get_dir( x, kv.flag ) = id; return (void*) id; }
 
     int remove( void* ptr ) const noexcept {
         if( ptr == nullptr ){ return -1; }
 
         auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & FLAG::KV_STATE_ERASE ){ return release( kv ); }
+            kv->data.flag|= FLAG::KV_STATE_ERASE;
+
         auto fl = kv->data.flag & FLAG::KV_STATE_READ 
                 ? EVFILT_READ   : EVFILT_WRITE;
         auto fd = kv->data.fd;
 
+        auto& x = get_kfd( fd ); if( get_dir( x, kv->data.flag )==ptr ){
+              get_dir( x, kv->data.flag ) = nullptr;
         KPOLLFD event ;
         EV_SET( &event, fd, fl, EV_DELETE, 0, 0, NULL );
-        kevent( obj->pd, &event, 1, NULL, 0, NULL );
+        kevent( obj->pd, &event, 1, NULL, 0, NULL ); }
 
-    obj->kv_queue.erase(kv); return 0; }
+    obj->kv_timer.off( kv->data.timer ); kv->data.timer=nullptr; return release( kv ); }
 
-    /*─······································································─*/
-
-    void* get_nearest_timeout( ulong time ) const noexcept {
-        if( time == 0 ){ return nullptr; }
-
-        auto x = obj->kv_queue.first(); while( x!=nullptr ){
-        if( 0   ==x->data.timeout ){ return x; }
-        if( time<=x->data.timeout ){ return x; }
-        x = x->next; }
-
-    return nullptr; }
+    int release( void* ptr ) const noexcept {
+        auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & FLAG::KV_STATE_USED ){ return 0; }
+    obj->kv_queue.erase( kv ); return 0; }
 
     /*─······································································─*/
 
-    ptr_t<KTIMER> get_delay() const noexcept {
+    KTIMER* get_delay() const noexcept {
 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
         ulong time = TIMEOUT; /*------------------*/
 
+        long  tout = obj->kv_timer.get_delay(); /*-*/
+
         if(( tasks==0 && obj->kv_queue.size()>0 ) || 
            ( tasks==0 && obj.count()         >1 ) 
-        ) { return nullptr; }
+        ) { if( tout<0 ){ return nullptr; } time = tout; }
+        elif( tout>=0 ){ time = min( time, (ulong) tout ); }
 
-        ptr_t<KTIMER> ts( 0UL, KTIMER() );
-        
-        ts->tv_sec  =  time / 1000;
-        ts->tv_nsec = (time % 1000) * 1000000;
+        obj->ts.tv_sec  =  time / 1000;
+        obj->ts.tv_nsec = (time % 1000) * 1000000;
 
-    return ts; }
+    return &obj->ts; }
 
     int get_delay_ms() const noexcept { 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
-        ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
+        ulong time = TIMEOUT==0 ? !obj->tb.full : TIMEOUT;
+        long  tout = obj->kv_timer.get_delay(); /*-*/
         if(( tasks==0 && obj->kv_queue.size()>0 ) || 
            ( tasks==0 && obj.count()         >1 ) 
-        ) { return -1; } return time;
+        ) { return tout; } return tout<0 ? time : min( time, (ulong) tout );
+    }
+
+    /* one zero-timeout poll for busy_wait(): >0 events, 0 none, <0 error. */
+
+    int peek() const noexcept { KTIMER zero; zero.tv_sec = 0; zero.tv_nsec = 0;
+        return obj->idx = kevent( obj->pd, NULL, 0, &obj->ev, obj->ev.size(), &zero );
     }
 
 protected:
@@ -408,18 +1192,26 @@ protected:
     struct NODE {
         loop_t /*------*/ ev_queue;
         queue_t<kevent_t> kv_queue;
+        wheel_t /*-----*/ kv_timer;
         probe_t /*-----*/ probe;
-        ptr_t<KPOLLFD>    ev;
+        post_box_t /*--*/ post;
+        ptr_t<KPOLLFD>    ev; KTIMER ts;
+        ptr_t<kfd_t>      kv_fd;
+        void *kv_head=nullptr, *kv_tail=nullptr;
+        ulong kv_ready=0, kv_round=0;
+        busy_poll_t bp; task_budget_t tb;
+        NODEPP_STATS( loop_stats_t st; )
         int pd, idx; 
     };  ptr_t<NODE> obj;
 
 public:
 
    ~kernel_t() noexcept { 
-        if( obj.count() > 1 ){ return; } close( obj->pd ); 
+        if( obj.count() > 1 ){ return; } obj->post.close(); close( obj->pd ); 
     }
 
-    kernel_t() : obj( new NODE() ) {
+    kernel_t() : obj( ptr::make<NODE>() ) {
+        obj->kv_queue.set_slab( true );
         obj->pd = kqueue();
 
     if( obj->pd==-1 )
@@ -432,13 +1224,17 @@ public:
     if( kevent( obj->pd, &ev, 1, NULL, 0, NULL ) == -1 )
       { throw except_t("Can't Initialize kernel_t"); }
 
+        int pd = obj->pd; obj->post.set_wake([=](){ KPOLLFD ev;
+            EV_SET( &ev, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr );
+        return kevent( pd, &ev, 1, NULL, 0, NULL ); });
+
     }
 
 public:
 
-    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj.count()-1; }
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
 
-    void clear() const noexcept { /*--*/ obj->ev_queue.clear(); obj->kv_queue.clear(); obj->probe.clear(); }
+    void clear() const noexcept { ready_clear(); obj->kv_fd.reset(); obj->ev_queue.clear(); obj->kv_queue.clear(); obj->kv_timer.clear(); obj->probe.clear(); }
 
     bool empty() const noexcept { return size()==0; }
 
@@ -485,12 +1281,30 @@ public:
 
     /*─······································································─*/
 
-    int emit() const noexcept {
-        KPOLLFD ev;
-        EV_SET( &ev, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr );
-        return kevent( obj->pd, &ev, 1, NULL, 0, NULL );
+    void set_budget( ulong task, ulong time=0 ) const noexcept {
+         obj->tb.limit = obj->tb.task = task; obj->tb.time = time; 
+         obj->tb.count = 0; obj->tb.full = false;
     }
 
+    task_budget_t get_budget() const noexcept { return obj->tb; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong time ) const noexcept { obj->bp.limit = obj->bp.budget = time; }
+
+    busy_poll_t get_busy_poll() const noexcept { return obj->bp; }
+
+    /*─······································································─*/
+
+    loop_stats_t get_stats() const noexcept {
+        auto out = obj->ev_queue.get_stats(); out.kv_queue = obj->kv_queue.size();
+        NODEPP_STATS( out.merge( obj->st ); )
+    return out; }
+
+    /*─······································································─*/
+
+    int emit() const noexcept { return obj->post.emit(); }
+
     /*─······································································─*/
 
     template< class T, class... V > 
@@ -508,22 +1322,25 @@ public:
 
     inline int next() const {
 
-        while( obj->ev_queue.next() >= 0 ){ return 1; } 
-        process::set_timeout(obj->ev_queue.get_delay());
-
-        auto stamp = process::now();
-
-        do   { auto x=obj->kv_queue.first(); while( x != nullptr ){
-               auto y=x->next; if( x->data.timeout==0 ) { break; }
-        if   ( x->data.flag & TASK_STATE::USED ){ x=y; continue; }
-        if   ( x->data.timeout < stamp ){ remove(x); }
-        else { break; } x=y; }} while(0);
-
-        obj->idx=kevent( obj->pd, NULL, 0, &obj->ev, obj->ev.size(), &get_delay() );
+        while( batch_next() ){ return 1; }
+        process::set_timeout( obj->kv_ready>0 ? 0 : obj->ev_queue.get_delay() );
+
+        obj->kv_timer.next( process::now(), [&]( void* address ){
+            auto x = obj->kv_queue.as( address ); x->data.timer = nullptr;
+        if( x->data.flag & FLAG::KV_STATE_USED ){ x->data.flag |= FLAG::KV_STATE_CLOSED; }
+        else /*-------------------------------*/{ remove( x ); }
+        });
+
+        if( !busy_wait() ){
+        obj->idx=kevent( obj->pd, NULL, 0, &obj->ev, obj->ev.size(), get_delay() ); }
+        process::get_clock( true );
+        NODEPP_STATS( ++obj->st.wakeup; obj->st.event += obj->idx>0 ? obj->idx : 0; )
+        busy_done( obj->idx>0 );
+        batch_done( obj->idx>0 );
         
         while( obj->idx > 0 ){ obj->idx--; auto x = obj->ev[ obj->idx ];
             
-            if( x.filter==EVFILT_USER ){ continue; }
+            if( x.filter==EVFILT_USER ){ post_next(); continue; }
             auto y = obj->kv_queue.as ( x.udata );
             if( !obj->kv_queue.is_valid( y ) ){ continue; }
 
@@ -532,18 +1349,7 @@ public:
             ) { remove( y ); continue; }
 
             if( y->data.flag & FLAG::KV_STATE_USED ){ continue; }
-                y->data.flag|= FLAG::KV_STATE_USED;
-
-            obj->ev_queue.add( coroutine::add( COROUTINE(){
-            coBegin
-
-                do { switch( y->data.callback() ) {
-                case -1: remove(y); /*----------------------*/ coEnd; break;
-                case  0: y->data.flag &=~ FLAG::KV_STATE_USED; coEnd; break;
-                case  1: break; } coNext; } while(1);
-
-            coFinish
-            }));
+                y->data.flag|= FLAG::KV_STATE_USED; ready_push( y );
 
         } process::clear_timeout(); return 1; }
 
@@ -555,9 +1361,11 @@ public:
 
 #ifdef NODEPP_POLL_NPOLL
 
-namespace nodepp { class kernel_t {
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
 private:
 
+    friend class reactor_t<kernel_t>;
+
     enum FLAG { 
          KV_STATE_UNKNONW = 0b00000000, 
          KV_STATE_WRITE   = 0b00000001,
@@ -569,17 +1377,18 @@ private:
     };
 
     struct kevent_t { public:
-        function_t<int> callback;
+        function_t<int> callback; void* timer;
         ulong timeout; int fd, flag; 
     };
 
     /*─······································································─*/
 
+    /* nothing here can wake a sleeping loop, so while handles can post  *
+     * to it the loop naps 1ms at a time instead of waiting on TIMEOUT.   */
+
     int get_delay_ms() const noexcept { 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
         ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
-        if(( tasks==0 && obj.count() > 1 ) 
-        ) { return -1; } return time;
+        if( obj.count() > 1 || obj->post.handles() > 0 ){ return 1; } return time;
     }
 
 protected:
@@ -587,11 +1396,14 @@ protected:
     struct NODE {
         probe_t   probe;
         loop_t ev_queue;
+        post_box_t /*--*/ post;
     };  ptr_t<NODE> obj;
 
 public:
 
-    kernel_t() noexcept : obj( new NODE() ) {}
+    kernel_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+   ~kernel_t() noexcept { if( obj.count() > 1 ){ return; } obj->post.close(); }
 
 public:
 
@@ -605,13 +1417,25 @@ public:
 
     /*─······································································─*/
 
-    ulong size() const noexcept { return obj->ev_queue.size() + obj->probe.get() + obj.count()-1; }
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
 
     void clear() const noexcept { /*--*/ obj->ev_queue.clear(); obj->probe.clear(); }
 
     bool empty() const noexcept { return size()==0; }
 
-    int   emit() const noexcept { return -1; }
+    int   emit() const noexcept { return  0; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong /*unused*/ ) const noexcept {}
+
+    busy_poll_t get_busy_poll() const noexcept { return busy_poll_t(); }
+
+    void set_budget( ulong /*unused*/, ulong /*unused*/=0 ) const noexcept {}
+
+    task_budget_t get_budget() const noexcept { return task_budget_t(); }
+
+    loop_stats_t get_stats() const noexcept { return obj->ev_queue.get_stats(); }
 
     /*─······································································─*/
 
@@ -633,10 +1457,11 @@ public:
 
     inline int next() const {
 
+        if( !obj->post.empty() ){ post_next(); }
         while( obj->ev_queue.next() >= 0 ){ return 1; } 
         process::set_timeout(obj->ev_queue.get_delay());
         process::delay( get_delay_ms() );
-        process::clear_timeout();
+        process::get_clock( true ); process::clear_timeout();
 
     return 1; }
 
@@ -25,6 +25,15 @@ namespace nodepp { namespace worker {
     inline pthread_t pid(){ return pthread_self(); }
     inline void     exit(){ pthread_exit(NULL); }
 
+    inline int affinity( ulong cpu ){
+    #if defined(__linux__)
+        cpu_set_t set; CPU_ZERO( &set ); CPU_SET( cpu, &set );
+        return pthread_setaffinity_np( pthread_self(), sizeof(set), &set )==0 ? 1 : -1;
+    #else
+        return -1;
+    #endif
+    }
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -39,7 +48,7 @@ protected:
 
 public:
 
-    mutex_t() : obj( new NODE() ) {
+    mutex_t() : obj( ptr::make<NODE>() ) {
         if( pthread_mutex_init(&obj->fd,NULL)!=0 )
           { throw except_t("Cant Start Mutex");  }
             /*-----------------*/ obj->alive=1;
@@ -102,26 +102,26 @@ public:
     event_t<string_t>  onDerr;
 
     popen_t( const string_t& path, const initializer_t<string_t>& args, const initializer_t<string_t>& envs )
-    : obj( new NODE() ) { if( path.empty() ){ throw except_t("invalid command"); }
+    : obj( ptr::make<NODE>() ) { if( path.empty() ){ throw except_t("invalid command"); }
         array_t<const char*> arg; array_t<const char*> env;
         for( auto x : args ) { arg.push( x.get() ); } /*---------------------*/
         for( auto x : envs ) { env.push( x.get() ); } _init_( path, arg, env );
     }
 
     popen_t( const string_t& path ) 
-    : obj( new NODE() ) { if( path.empty() ){ throw except_t("invalid command"); }
+    : obj( ptr::make<NODE>() ) { if( path.empty() ){ throw except_t("invalid command"); }
         array_t<const char*> arg; array_t<const char*> env; auto cmd = regex::match_all( path, "[^ ]+" );
         for( auto x: cmd ){ arg.push( x.get() ); } _init_( cmd[0], arg, env ); /*----------------------*/
     }
 
     popen_t( const string_t& path, const initializer_t<string_t>& args ) 
-    : obj( new NODE() ) { if ( path.empty() ){ throw except_t("invalid command"); }
+    : obj( ptr::make<NODE>() ) { if ( path.empty() ){ throw except_t("invalid command"); }
         array_t<const char*> arg; array_t<const char*> env;
         for( auto x : args ) { arg.push( x.get() ); }
         _init_( path, arg, env ); /*---------------*/
     }
 
-    popen_t() noexcept : obj( new NODE() ) {}
+    popen_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~popen_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
 
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_POSIX_SEMAPHORE
+#define NODEPP_POSIX_SEMAPHORE
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include <pthread.h>
+#include <time.h>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class semaphore_t {
+protected:
+
+    /* a counting semaphore on a mutex + condition pair: unnamed sem_t  *
+     * has no timed wait on macOS, and wait( ms ) is what callers need. */
+
+    struct NODE {
+        atomic_t<bool> alive=1; ulong count=0;
+        pthread_mutex_t mut; pthread_cond_t cond;
+    };  ptr_t<NODE> obj;
+
+public:
+
+    semaphore_t( ulong count=0 ) : obj( ptr::make<NODE>() ) {
+        if( pthread_mutex_init(&obj->mut,NULL)!=0 )
+          { throw except_t("Cant Start Semaphore"); }
+        if( pthread_cond_init(&obj->cond,NULL)!=0 )
+          { pthread_mutex_destroy(&obj->mut); throw except_t("Cant Start Semaphore"); }
+            obj->count=count; obj->alive=1;
+    }
+
+    virtual ~semaphore_t() noexcept {
+        if( obj->alive == 0 ){ return; }
+        if( obj.count() > 1 ){ return; }
+    free(); }
+
+    /*─······································································─*/
+
+    void free() const noexcept {
+        if( obj->alive == 0 ){ return; }
+        /*----------*/ obj->alive = 0;
+        pthread_cond_destroy (&obj->cond);
+        pthread_mutex_destroy(&obj->mut );
+    }
+
+    /*─······································································─*/
+
+    void post() const noexcept {
+        if( obj->alive == 0 ){ return; }
+        pthread_mutex_lock  (&obj->mut ); ++obj->count;
+        pthread_cond_signal (&obj->cond);
+        pthread_mutex_unlock(&obj->mut );
+    }
+
+    void wait() const noexcept {
+        if( obj->alive == 0 ){ return; }
+        pthread_mutex_lock(&obj->mut);
+        while( obj->count==0 ){ pthread_cond_wait(&obj->cond,&obj->mut); }
+        --obj->count; pthread_mutex_unlock(&obj->mut);
+    }
+
+    /* false once time ms pass without a post */
+
+    bool wait( ulong time ) const noexcept {
+        if( obj->alive == 0 ){ return false; } struct timespec ts;
+        clock_gettime( CLOCK_REALTIME, &ts );
+        ts.tv_sec += time / 1000; ts.tv_nsec += ( time % 1000 ) * 1000000;
+        if( ts.tv_nsec >= 1000000000 ){ ts.tv_nsec -= 1000000000; ++ts.tv_sec; }
+
+        pthread_mutex_lock(&obj->mut); while( obj->count==0 ){
+            if( pthread_cond_timedwait(&obj->cond,&obj->mut,&ts)!=0 ){ break; }
+        }   bool done = obj->count>0; if( done ){ --obj->count; }
+        pthread_mutex_unlock(&obj->mut); return done;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
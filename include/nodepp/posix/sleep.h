@@ -15,6 +15,7 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include <unistd.h>
+#include <time.h>
 #include <sys/time.h>
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -40,6 +41,37 @@ namespace nodepp { namespace process {
         return time.tv_sec * 1000 + time.tv_usec / 1000; 
     }
 
+    /* monotonic ms, so deadlines survive NTP steps and manual clock      *
+     * changes. Read on every call; now() is its cached per-loop copy.    */
+
+    inline ulong uptime(){ struct timespec time;
+    #if   defined( NODEPP_CLOCK_COARSE ) && defined( CLOCK_MONOTONIC_COARSE )
+        clock_gettime( CLOCK_MONOTONIC_COARSE, &time );
+    #else
+        clock_gettime( CLOCK_MONOTONIC, &time );
+    #endif
+        return time.tv_sec * 1000 + time.tv_nsec / 1000000;
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    /* loop clock: uptime(), refreshed by the kernel once per iteration     *
+     * right after its poll returns, so every timer in that round shares a  *
+     * single clock read. A thread that never refreshed it reads uptime()   *
+     * on every call instead. Code that spins without polling must check    *
+     * its deadlines against uptime(), since now() won't move there.        */
+
+    inline ulong& get_clock( bool update=false ) {
+    thread_local static ulong stamp=0; thread_local static bool live=false;
+        if( update || !live ){ live |= update; stamp = uptime(); }
+    return stamp; }
+
+    inline ulong now(){ return get_clock(); }
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -69,8 +101,6 @@ namespace nodepp { namespace process {
 
     inline void yield(){ delay(TIMEOUT); }
 
-    inline ulong now(){ return millis(); }
-
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -44,6 +44,7 @@ struct agent_t {
     ulong conn_timeout  = 1000;
     ulong recv_timeout  = 0;
     ulong send_timeout  = 0;
+    ulong busy_poll     = 0;
     bool  reuse_address = 1;
     bool  no_delay_mode = 0;
     bool  reuse_port    = 1;
@@ -55,7 +56,8 @@ class socket_t {
 protected:
 
     void kill() const noexcept {
-        obj->state |= STATE::FS_STATE_KILL; 
+        obj->state |= STATE::FS_STATE_KILL; if( obj->feed )
+      { process::NODEPP_EV_LOOP().feed_off( obj->fd ); obj->feed=0; }
         ::shutdown( obj->fd, SHUT_WR ); 
         ::close(obj->fd);
     }
@@ -95,7 +97,7 @@ protected:
         ulong range[2]= { 0, 0 };
 
         socklen_t addrlen, len;
-        int fd = -1, feof = 1; bool srv=0; 
+        int fd = -1, feof = 1; bool srv=0, feed=0; 
         uchar state = STATE::FS_STATE_OPEN;
         SOCKADDR_ST server_addr, client_addr;
 
@@ -104,6 +106,7 @@ protected:
         generator::file::line  _line ;
         generator::file::read  _read ;
         generator::file::write _write;
+        generator::file::writev _writev;
     };  ptr_t<NODE> obj;
 
     /*─······································································─*/
@@ -143,22 +146,22 @@ public:
     /*─······································································─*/
 
     ulong get_recv_timeout() const noexcept {
-        return obj->recv_timeout==0 ? process::millis() : obj->recv_timeout;
+        return obj->recv_timeout==0 ? process::uptime() : obj->recv_timeout;
     }
 
     ulong get_send_timeout() const noexcept {
-        return obj->send_timeout==0 ? process::millis() : obj->send_timeout;
+        return obj->send_timeout==0 ? process::uptime() : obj->send_timeout;
     }
 
     ulong get_conn_timeout() const noexcept {
-        return obj->conn_timeout==0 ? process::millis() : obj->conn_timeout;
+        return obj->conn_timeout==0 ? process::uptime() : obj->conn_timeout;
     }
 
     /*─······································································─*/
 
     ulong set_conn_timeout( ulong time ) const noexcept {
         if( time == 0 ){ obj->conn_timeout = 0; return 0; }
-        obj->conn_timeout = process::millis() + time; 
+        obj->conn_timeout = process::uptime() + time; 
         return time;
     }
 
@@ -166,14 +169,14 @@ public:
         if( time == 0 ){ obj->recv_timeout = 0; return 0; }
         TIMEVAL en; memset( &en, 0, sizeof(en) ); en.tv_sec = time / 1000; en.tv_usec = 0;
     int c= setsockopt( obj->fd, SOL_SOCKET, SO_RCVTIMEO, (char*)&en, sizeof(en) ); 
-        obj->recv_timeout = process::millis() + time; return c==0 ? time : 0;
+        obj->recv_timeout = process::uptime() + time; return c==0 ? time : 0;
     }
 
     ulong set_send_timeout( ulong time ) const noexcept {
         if( time == 0 ){ obj->send_timeout = 0; return 0; }
         TIMEVAL en; memset( &en, 0, sizeof(en) ); en.tv_sec = time / 1000; en.tv_usec = 0;
     int c= setsockopt( obj->fd, SOL_SOCKET, SO_SNDTIMEO, (char*)&en, sizeof(en) ); 
-        obj->send_timeout = process::millis() + time; return c==0 ? time : 0;
+        obj->send_timeout = process::uptime() + time; return c==0 ? time : 0;
     }
 
     /*─······································································─*/
@@ -230,6 +233,23 @@ public:
     }
 #endif
 
+#ifdef SO_BUSY_POLL
+    int set_busy_poll( uint en ) const noexcept {
+    int c= setsockopt( obj->fd, SOL_SOCKET, SO_BUSY_POLL, (char*)&en, sizeof(en) );
+    #ifdef SO_PREFER_BUSY_POLL
+        uint fl = en>0; setsockopt( obj->fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, (char*)&fl, sizeof(fl) );
+    #endif
+        return c;
+    }
+#endif
+
+#ifdef SO_INCOMING_CPU
+    int set_incoming_cpu( uint en ) const noexcept {
+    int c= setsockopt( obj->fd, SOL_SOCKET, SO_INCOMING_CPU, (char*)&en, sizeof(en) );
+        return c;
+    }
+#endif
+
     int get_no_delay_mode() const noexcept { int en; socklen_t size = sizeof(en);
     int c= getsockopt( obj->fd, IPPROTO, TCP_NODELAY, (char*)&en, &size ); 
         return c==0 ? en : c;
@@ -272,6 +292,20 @@ public:
     }
 #endif
 
+#ifdef SO_BUSY_POLL
+    int get_busy_poll() const noexcept { int en; socklen_t size = sizeof(en);
+    int c= getsockopt(obj->fd, SOL_SOCKET, SO_BUSY_POLL, (char*)&en, &size);
+        return c==0 ? en : c;
+    }
+#endif
+
+#ifdef SO_INCOMING_CPU
+    int get_incoming_cpu() const noexcept { int en; socklen_t size = sizeof(en);
+    int c= getsockopt(obj->fd, SOL_SOCKET, SO_INCOMING_CPU, (char*)&en, &size);
+        return c==0 ? en : c;
+    }
+#endif
+
     int get_ipv6_only_mode() const noexcept { int en; socklen_t size = sizeof(en);
     int c= getsockopt(obj->fd, IPPROTO_IPV6, IPV6_V6ONLY, (char*)&en, &size);
         return c==0 ? en : c;
@@ -384,6 +418,10 @@ public:
         set_buffer_size  ( opt.buffer_size   );
     #ifdef SO_REUSEPORT
         set_reuse_port   ( opt.reuse_port    );
+    #endif
+    #ifdef SO_BUSY_POLL
+        if( opt.busy_poll>0 )
+      { set_busy_poll    ( opt.busy_poll     ); }
     #endif
         set_keep_alive   ( opt.keep_alive    );
         set_broadcast    ( opt.broadcast     );
@@ -398,6 +436,9 @@ public:
         opt.buffer_size   = get_buffer_size();
     #ifdef SO_REUSEPORT
         opt.reuse_port    = get_reuse_port();
+    #endif
+    #ifdef SO_BUSY_POLL
+        opt.busy_poll     = max( 0, get_busy_poll() );
     #endif
         opt.keep_alive    = get_keep_alive();
         opt.broadcast     = get_broadcast();
@@ -406,14 +447,14 @@ public:
 
     /*─······································································─*/
 
-    socket_t( int fd, ulong _size=CHUNK_SIZE ) : obj( new NODE() ) { _socket_::start_device();
+    socket_t( int fd, ulong _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) { _socket_::start_device();
         if( fd == INVALID_SOCKET ){ throw except_t("Such Socket has an Invalid fd"); }
         obj->fd = fd; set_nonbloking_mode(); set_buffer_size(_size);
     }
     
     virtual ~socket_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
 
-    socket_t() noexcept : obj( new NODE() ) { _socket_::start_device(); }
+    socket_t() noexcept : obj( ptr::make<NODE>() ) { _socket_::start_device(); }
 
     /*─······································································─*/
 
@@ -468,14 +509,25 @@ public:
     /*─······································································─*/
 
     int _connect() const noexcept { int c=0;
-        if( process::millis() > get_conn_timeout() || obj->srv==1 ){ return -1; }
+        if( process::uptime() > get_conn_timeout() || obj->srv==1 ){ return -1; }
         return is_blocked( c=::connect( obj->fd, (SOCKADDR*) &obj->server_addr, obj->addrlen ) ) ? -2 : c>=0 ? 1: -1;
     }
 
     int _accept() const noexcept { int c=0; if( obj->srv == 0 ){ return -1; }
+        if( obj->feed ){ c = process::NODEPP_EV_LOOP().feed_accept( obj->fd );
+        if( c!=-3 ){ return c; } obj->feed=0; }
         return is_blocked( c=::accept( obj->fd, (SOCKADDR*) &obj->server_addr, &obj->addrlen ) ) ? -2 : c;
     }
 
+    /* hands the fd to the event loop when its backend can accept and   *
+     * recv ahead of the reader ( NODEPP_POLL_URING ): _accept() and     *
+     * __read() then take what it already staged instead of a syscall.   *
+     * Only for fds this thread's loop polls and that nobody else reads. */
+
+    int set_feed() const noexcept { if( obj->feed ){ return 1; }
+        obj->feed = process::NODEPP_EV_LOOP().feed_add( obj->fd, obj->srv )==1;
+    return obj->feed ? 1 : -1; }
+
     /*─······································································─*/
 
     int listen() const noexcept { if( obj->srv == 0 ){ return -1; }
@@ -508,6 +560,11 @@ public:
         return obj->_write.data;
     }
 
+    ulong write( const buffer_chain_t& msg ) const noexcept {
+        while( obj->_writev( this, msg )==1 ){ process::next(); }
+        return obj->_writev.data;
+    }
+
     /*─······································································─*/
 
     string_t read_until( string_t ch ) const noexcept {
@@ -529,13 +586,17 @@ public:
 
     virtual int _read ( char* bf, const ulong& sx ) const noexcept { return __read ( bf, sx ); }
     virtual int _write( char* bf, const ulong& sx ) const noexcept { return __write( bf, sx ); }
+    virtual int _writev( const buffer_chain_t& bf ) const noexcept { return __writev( bf ); }
 
     /*─······································································─*/
 
     virtual int __read( char* bf, const ulong& sx ) const noexcept {
-        if ( process::millis() > get_recv_timeout() || is_closed() )
+        if ( process::uptime() > get_recv_timeout() || is_closed() )
            { return -1; } if ( sx==0 ) { return 0; }
 
+        if ( obj->feed ){ int res = process::NODEPP_EV_LOOP().feed_read( obj->fd, bf, sx );
+        if ( res!=-3 ){ obj->feof = res; return res>0 ? res : -2; } obj->feed=0; }
+
         int res = ( SOCK != SOCK_DGRAM ) 
                 ? ::recv    ( obj->fd, bf, sx, 0 )
                 : ::recvfrom( obj->fd, bf, sx, 0, get_addr(), &obj->len );
@@ -544,7 +605,7 @@ public:
     return ( obj->feof <= 0 && obj->feof != -2 ) ? -2 : obj->feof; }
 
     virtual int __write( char* bf, const ulong& sx ) const noexcept {
-        if ( process::millis() > get_send_timeout() || is_closed() )
+        if ( process::uptime() > get_send_timeout() || is_closed() )
            { return -1; } if ( sx==0 ) { return 0; } 
 
         int res = ( SOCK != SOCK_DGRAM ) 
@@ -554,6 +615,23 @@ public:
              obj->feof = is_blocked( res )? -2 : res;
     return ( obj->feof <= 0 && obj->feof != -2 ) ? -2 : obj->feof; }
 
+    virtual int __writev( const buffer_chain_t& bf ) const noexcept {
+        if ( process::uptime() > get_send_timeout() || is_closed() )
+           { return -1; } if ( bf.empty() ) { return 0; }
+
+        struct iovec vec[ buffer_chain_t::CHAIN_IOV ]; ulong n=0;
+        auto x = bf.get_queue().first(); while( x!=nullptr && n<buffer_chain_t::CHAIN_IOV ){
+             vec[n].iov_base = x->data.data(); vec[n].iov_len = x->data.size(); ++n; x = x->next;
+        }
+
+        struct msghdr msg; memset( &msg, 0, sizeof(msg) );
+        msg.msg_iov = vec; msg.msg_iovlen = n; if( SOCK == SOCK_DGRAM )
+      { msg.msg_name = get_addr(); msg.msg_namelen = obj->len; }
+
+        int res = ::sendmsg( obj->fd, &msg, 0 );
+             obj->feof = is_blocked( res )? -2 : res;
+    return ( obj->feof <= 0 && obj->feof != -2 ) ? -2 : obj->feof; }
+
     /*─······································································─*/
 
     int _write_( char* bf, const ulong& sx, ulong* sy ) const noexcept {
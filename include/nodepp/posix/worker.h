@@ -48,7 +48,7 @@ protected:
             worker::delay( info.delay ); 
         } else { 
             worker::yield();
-        }}
+        }   process::get_clock( true ); }
 
     self->obj->state = STATE::WK_STATE_CLOSE; 
     self->obj->krn->emit(); /**/ delete self; 
@@ -57,14 +57,14 @@ protected:
 public:
 
     template< class T, class... V >
-    worker_t( T cb, const V&... arg ) noexcept : obj( new NODE() ){
+    worker_t( T cb, const V&... arg ) noexcept : obj( ptr::make<NODE>() ){
         auto clb = type::bind(cb);
         obj->cb  = function_t<int>([=](){ return (*clb)(arg...); });
     }
     
     /*─······································································─*/
 
-    worker_t() noexcept : obj( new NODE ) {}
+    worker_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~worker_t() noexcept { if( obj.count()>1 ){ return; } free(); }
     
@@ -151,22 +151,22 @@ protected:
             worker::delay( info.delay ); 
         } else { 
             worker::yield();
-        }}
+        }   process::get_clock( true ); }
 
-    self->obj->state = STATE::WK_STATE_CLOSE;
+    self->obj->state = STATE::WK_STATE_CLOSE; delete self;
     worker::exit(); return nullptr; }
 
 public:
 
     template< class T, class... V >
-    worker_t( T cb, const V&... arg ) noexcept : obj( new NODE() ){
+    worker_t( T cb, const V&... arg ) noexcept : obj( ptr::make<NODE>() ){
         auto clb = type::bind(cb);
         obj->cb  = function_t<int>([=](){ return (*clb)(arg...); });
     }
     
     /*─······································································─*/
 
-    worker_t() noexcept : obj( new NODE ) {}
+    worker_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~worker_t() noexcept { if( obj.count()>1 ){ return; } free(); }
     
@@ -188,7 +188,7 @@ public:
     int emit() const noexcept { 
         
         if( obj->state != 0x00 ) { return 0; } auto self = type::bind( this );
-        auto pth = pthread_create( &obj->id, NULL, &callback, (void*) &self );
+        auto pth = pthread_create( &obj->id, NULL, &callback, (void*) new worker_t(*this) );
         if ( pth!= 0 ){ return -1; } pthread_detach( obj->id ); 
         
         process::add( coroutine::add( COROUTINE(){
@@ -210,7 +210,7 @@ public:
     int await() const noexcept {
 
         if( obj->state != 0x00 ) { return 0; } auto self = type::bind( this );
-        auto pth = pthread_create( &obj->id, NULL, &callback, (void*) &self );
+        auto pth = pthread_create( &obj->id, NULL, &callback, (void*) new worker_t(*this) );
         if ( pth!= 0 ){ return -1; } pthread_detach( obj->id ); 
         
         process::await( coroutine::add( COROUTINE(){
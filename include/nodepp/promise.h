@@ -91,11 +91,11 @@ public:
 
    ~promise_t() noexcept { if( obj.count()>1 ){ return; } emit(); }
 
-    promise_t( const NODE_CLB& cb ) noexcept : obj( new NODE() ) {
+    promise_t( const NODE_CLB& cb ) noexcept : obj( ptr::make<NODE>() ) {
         obj->node_clb=cb; obj->state=PROMISE_STATE::OPEN;
     }
 
-    promise_t() noexcept : obj( new NODE() ) {}
+    promise_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
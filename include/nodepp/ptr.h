@@ -53,10 +53,20 @@ private:
          PTR_FLAG_UNKNOWN = 0b00000000,
          PTR_FLAG_HEAP    = 0b00000001,
          PTR_FLAG_STACK   = 0b00000010,
-         PTR_FLAG_USED    = 0b00000100
+         PTR_FLAG_USED    = 0b00000100,
+         PTR_FLAG_INLINE  = 0b00001000,
+         PTR_FLAG_ARENA   = 0b00010000
     };
 
     using NODE = typename type::conditional<( SSO==1 ),NODE_HEAP,NODE_STACK>::type;
+
+    /* PTR_FLAG_INLINE: the value lives in the same allocation as NODE,   *
+     * GAP bytes after it, so one malloc serves both ( see ptr::make ).   */
+
+    enum INLINE {
+         GAP = ( sizeof(NODE) + alignof(T) - 1 ) / alignof(T) * alignof(T),
+         RAW = alignof(T) <= 16
+    };
     ulong offset=0, limit=0;
 
     /*─······································································─*/
@@ -67,7 +77,9 @@ private:
         if  ( address->value==nullptr ){ return -1; }
         if  ( address->flag ==0x00    ){ return -1; }
 
-        if  ( address->flag & FLAG::PTR_FLAG_HEAP ){
+        if  ( address->flag & FLAG::PTR_FLAG_INLINE ){
+        for ( ulong x=max( 1UL, address->length ); x-->0; ){ address->value[x].~T(); }}
+        elif( address->flag & FLAG::PTR_FLAG_HEAP ){
         if  ( address->length!= 0 ){ delete [] address->value; }
         else /*-----------------*/ { delete    address->value; }}
         
@@ -83,14 +95,28 @@ private:
 
     #ifndef NODEPP_ATOMIC_SMART_POINTER_OFF
         if( address->count.sub(1) == 1 )
-          { _free_(address); delete address; }
+          { _drop_(address); }
     #else
         if( address->count  --    == 1 )
-          { _free_(address); delete address; }
+          { _drop_(address); }
     #endif
 
     address = nullptr; return 1; }
 
+    inline void _drop_( NODE* address ) const noexcept {
+        bool arn = address->flag & FLAG::PTR_FLAG_ARENA; _free_( address );
+        address->~NODE(); if( arn ){ arena::release( address ); } 
+        else /*---------------*/ { ::operator delete( (void*) address ); }
+    }
+
+    /* nodes come from the thread's current arena_t when there is one   *
+     * ( see arena_t::use ), otherwise from plain operator new.          */
+
+    inline void* _alloc_( ulong size, int& flag ) const noexcept {
+        auto mem = arena::get_current(); if( mem==nullptr ){ return ::operator new( size ); }
+        flag |= FLAG::PTR_FLAG_ARENA; return arena::alloc( mem, size );
+    }
+
     /*─······································································─*/
 
     inline int _set_( NODE*& address, T* value, ulong N, bool ) noexcept {
@@ -120,6 +146,13 @@ private:
     return 1; }
 
     inline int _set_( NODE*& address, ulong N, bool ) noexcept {
+
+        if( !_sso_( N ) && INLINE::RAW ){
+        if( _raw_( address, N )==-1 ){ return -1; }
+        if( N==0 ){ new( (void*) address->value ) T(); }
+        else      { for( ulong x=0; x<N; ++x ){ new( (void*)( address->value+x ) ) T; }}
+        return 1; }
+
         if( _set_( address, N )==-1 ){ return -1; }
 
         if( address->flag & FLAG::PTR_FLAG_STACK ){
@@ -144,18 +177,39 @@ private:
 
     /*─······································································─*/
 
+    inline bool _sso_( ulong N ) const noexcept {
+        ulong r_size = (N == 0) ? sizeof(T) : (sizeof(T) * N);
+        return r_size <= SSO && type::is_trivially_copyable<T>::value;
+    }
+
+    inline int _raw_( NODE*& address, ulong N ) noexcept {
+
+        if( address != nullptr && _del_( address )==-1 )
+          { address = nullptr; return -1; } address = nullptr;
+
+        int   flag   = FLAG::PTR_FLAG_USED | FLAG::PTR_FLAG_INLINE;
+        void* raw    = _alloc_( INLINE::GAP + sizeof(T) * max( 1UL, N ), flag );
+        address      = new( raw ) NODE(); offset=0; limit=N;
+
+        address->count  = 1 ;
+        address->length = N ;
+        address->value  = (T*)( (char*) raw + INLINE::GAP );
+        address->flag   = flag;
+
+    return 1; }
+
     inline int _new_( NODE*& address, ulong N ) noexcept {
         if( address!= nullptr ){ return -1; }
 
-        ulong r_size = (N == 0) ? sizeof(T) : (sizeof(T) * N);
-        address      = new NODE(); offset=0; limit=N;
+        int   flag   = FLAG::PTR_FLAG_USED;
+        address      = new( _alloc_( sizeof(NODE), flag ) ) NODE(); offset=0; limit=N;
 
         address->count  = 1 ;
         address->length = N ;
         address->value  = nullptr;
-        address->flag   = FLAG::PTR_FLAG_USED;
+        address->flag   = flag;
 
-        if  ( r_size <= SSO && type::is_trivially_copyable<T>::value ){
+        if  ( _sso_( N ) ){
               address->value= (T*)( address->stack );
               address->flag|= FLAG::PTR_FLAG_STACK; } 
         else{ address->flag|= FLAG::PTR_FLAG_HEAP ; }
@@ -314,6 +368,16 @@ public:
 
     /*─······································································─*/
 
+    template < class... V >
+    void emplace( const V&... args ) noexcept {
+        if( _sso_( 0 ) ){ if( _set_( address, 0 )==-1 ){ return; } 
+                          new( (void*) address->value ) T( args... ); return; }
+        if( !INLINE::RAW ){ resize( new T( args... ) ); /*----*/ return; }
+        if( _raw_( address, 0 )==-1 ){ return; } new( (void*) address->value ) T( args... );
+    }
+
+    /*─······································································─*/
+
     template < class V, ulong N >
     void fill( const V (&value)[N] ) const noexcept {
         if  ( empty() ){ return; }
@@ -344,6 +408,7 @@ public:
 
     ulong    count() const noexcept { return null() ? 0 /*-*/ : (ulong) address->count; }
     ulong     size() const noexcept { return null() ? 0 /*-*/ : limit - offset; }
+    ulong capacity() const noexcept { return null() ? 0 : max( 1UL, address->length ) - offset; }
     
     T*       begin() const noexcept { return null() ? nullptr : _begin_( address ); }
     T*         end() const noexcept { return null() ? nullptr : _end_  ( address ); }
@@ -459,12 +524,24 @@ namespace nodepp { namespace type {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { namespace ptr {
+
+    /* one allocation for the control block and the value, like          *
+     * make_shared: prefer ptr::make<T>( args... ) over ptr_t<T>( new T ). */
+
+    template< class T, class... V >
+    ptr_t<T> make( const V&... args ){ ptr_t<T> out; out.emplace( args... ); return out; }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace nodepp { namespace type {
 
     template< class T >
     ptr_t<T> bind( T* object ){
         if ( object==nullptr ){ return nullptr; }
-        return ptr_t<T>( new T( *object ) ); 
+        return ptr::make<T>( *object ); 
     }
 
     template<class T> 
@@ -479,12 +556,12 @@ namespace nodepp { namespace type {
     return out; }
 
     template<class T> 
-    typename type::enable_if<type::is_pod<T>::value, ptr_t<T>>::type 
+    typename type::enable_if<( type::is_pod<T>::value && type::is_trivially_constructible<T>::value ), ptr_t<T>>::type 
     bind( const T& object ) { return ptr_t<T>( 0UL, object ); }
 
     template<class T> 
-    typename type::enable_if<!type::is_pod<T>::value, ptr_t<T>>::type 
-    bind( const T& object ){ return ptr_t<T>( new T( object ) ); }
+    typename type::enable_if<!( type::is_pod<T>::value && type::is_trivially_constructible<T>::value ), ptr_t<T>>::type 
+    bind( const T& object ){ return ptr::make<T>( object ); }
 
 }}
 
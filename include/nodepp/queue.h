@@ -14,6 +14,10 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#include "slab.h"
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace nodepp {
 template< class V > class queue_t {
 protected:
@@ -30,8 +34,32 @@ protected:
            NODE *act    = nullptr;
            NODE *lst    = nullptr;
            ulong length = 0;
+    #ifdef NODEPP_QUEUE_SLAB
+           bool  slab   = 1;
+    #else
+           bool  slab   = 0;
+    #endif
+           arena::NODE_ARENA* mem = arena::ref( arena::get_current() );
+           DONE() noexcept {} DONE( const DONE& ) = delete;
+          ~DONE() noexcept { while( fst!=nullptr ){ auto x = fst->next; drop( fst ); fst = x; } 
+                             arena::unref( mem ); }
+           void drop( NODE* n ) noexcept {
+                if  ( mem!=nullptr ){ arena::drop( n ); }
+                elif( slab ) /*---*/{ slab ::drop( n ); } else { delete n; }
+           }
     };     ptr_t<DONE> obj;
 
+    /* a queue created inside arena_t::use() keeps its nodes in that arena; *
+     * otherwise they come from the per-thread slab cache when slab is set *
+     * ( see set_slab() or NODEPP_QUEUE_SLAB ), or from plain new/delete.  */
+
+    NODE* make_node( const V& value ) const {
+        if( obj->mem!=nullptr ){ return arena::make<NODE>( obj->mem, value ); }
+        return obj->slab ? slab::make<NODE>( value ) : new NODE( value );
+    }
+
+    void drop_node( NODE* n ) const noexcept { obj->drop( n ); }
+
     ptr_t<ulong> get_slice_range( long x, long y ) const noexcept {
 
         if( empty() || x == y ){ return nullptr; } if( y>0 ){ --y; }
@@ -93,21 +121,16 @@ public:
 
     /*─······································································─*/
 
-    queue_t<V> sort( function_t<bool,V,V> func ) const noexcept {
-    queue_t<V> n_buffer; auto x = this->first(); 
-
-    while( x != nullptr ){
-
-        if(!n_buffer.empty() && !func( x->data, n_buffer.last()->data ) ) 
-          { n_buffer.push( x->data ); } else {
-            auto n = n_buffer.first(); while( n != nullptr ){ 
-                if( !func( x->data, n->data ) ) { n = n->next; continue; } 
-            break; } n_buffer.insert( n, x->data );
-        }
-
-    x = x->next; }
+    template< class F >
+    queue_t<V> sort( F func ) const noexcept {
+        queue_t<V> out = copy(); if( out.size()<2 ){ return out; }
+        out.obj->fst = algorithm::sort_list( out.obj->fst, func );
+        out.obj->act = nullptr; NODE* prev = nullptr; auto x = out.obj->fst;
+        while( x!=nullptr ){ x->prev = prev; prev = x; x = x->next; }
+        out.obj->lst = prev; return out;
+    }
 
-    return n_buffer; }
+    queue_t<V> sort( function_t<bool,V,V> func ) const noexcept { return sort<function_t<bool,V,V>>( func ); }
 
     /*─······································································─*/
 
@@ -122,6 +145,14 @@ public:
 
     /*─······································································─*/
 
+    bool set_slab( bool en ) const noexcept {
+        if( !empty() ){ return false; } obj->slab = en; return true;
+    }
+
+    bool get_slab() const noexcept { return obj->slab; }
+
+    /*─······································································─*/
+
     ptr_t<V> data() const noexcept {
         if( empty() ){ return nullptr; } /*---------*/
         ptr_t<V> out( size() ); V* addr = out.begin();
@@ -193,7 +224,7 @@ public:
     queue_t copy() const noexcept { queue_t n_buffer;
         auto n = first(); while( n!=nullptr ){
              n_buffer.push( n->data );
-        n=n->next(); } return n_buffer;
+        n=n->next; } return n_buffer;
     }
 
     /*─······································································─*/
@@ -307,18 +338,18 @@ public:
 
     inline void insert( NODE* n, const V& value ) const noexcept {
         if( empty() ){
-            obj->fst = new NODE( value ); 
+            obj->fst = make_node( value ); 
             obj->fst->sign = &obj;
             obj->lst=first();
         } elif ( is_valid(n) ) {
-            auto m = new NODE( value ); 
+            auto m = make_node( value ); 
                  m->sign = &obj; m->prev = n->prev;
             if ( n->prev!= nullptr ){ n->prev->next = m; }
             if ( n->next== nullptr ){ obj->lst = n; }
             if ( m->prev== nullptr ){ obj->fst = m; }
                  m->next = n; n->prev =m;
         } else {
-            auto m = new NODE( value );
+            auto m = make_node( value );
                  m->sign = &obj; auto n = last();
             if ( n->prev== nullptr ){ obj->fst = n; }
             if ( m->next== nullptr ){ obj->lst = m; }
@@ -352,7 +383,7 @@ public:
         if( n->next != nullptr )/*-*/{ n->next->prev = n->prev; }} while(0); 
           
         n->sign = nullptr; /*---------*/ obj->length--; 
-        n->next = nullptr; n->prev = nullptr; delete n;
+        n->next = nullptr; n->prev = nullptr; drop_node( n );
     }
 
     /*─······································································─*/
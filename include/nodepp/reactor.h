@@ -0,0 +1,237 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_REACTOR
+#define NODEPP_REACTOR
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class post_box_t {
+private:
+
+    /* the part of a kernel other threads may reach: its inbox and the   *
+     * call that wakes its poller. loop_handle_t shares only this, so a  *
+     * kernel is always torn down by its own thread. state counts wakes  *
+     * in flight; close() sets POST_CLOSED and waits them out before the *
+     * kernel closes the fd they write to.                               */
+
+    enum POST { POST_CLOSED = 0x40000000 };
+
+protected:
+
+    struct NODE {
+        inbox_t<function_t<int>> inbox; function_t<int> wake;
+        atomic_t<ulong> state, handle;
+    };  ptr_t<NODE> obj;
+
+public:
+
+    post_box_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+    /*─······································································─*/
+
+    ulong    size() const noexcept { return obj->inbox.size(); }
+    bool    empty() const noexcept { return obj->inbox.empty(); }
+    ulong handles() const noexcept { return obj->handle.get(); }
+    bool is_closed() const noexcept { return obj->state.get() & POST_CLOSED; }
+
+    void attach() const noexcept { ++obj->handle; }
+    void detach() const noexcept { --obj->handle; }
+
+    /*─······································································─*/
+
+    /* owner thread only */
+
+    void set_wake( function_t<int> cb ) const noexcept { obj->wake = cb; }
+
+    bool pop( function_t<int>& cb ) const noexcept { return obj->inbox.pop( cb ); }
+
+    void ack() const noexcept { obj->inbox.ack(); }
+
+    void close() const noexcept { obj->state |= POST_CLOSED;
+        while( obj->state.get() != POST_CLOSED ){ /*unused*/ }
+    }
+
+    /*─······································································─*/
+
+    int emit() const noexcept {
+        if( obj->state++ & POST_CLOSED ){ --obj->state; return -1; }
+        int c = obj->wake(); --obj->state; return c;
+    }
+
+    template< class T, class... V >
+    int post( T cb, const V&... args ) const noexcept { 
+        if( is_closed() ){ return -1; } auto clb = type::bind( cb );
+        if( !obj->inbox.push([=](){ return (*clb)( args... ); }) ){ return 1; }
+    return emit()<0 ? -1 : 1; }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class K > class reactor_t {
+protected:
+
+    /* the poller-independent half of kernel_t. Every backend derives from *
+     * reactor_t<kernel_t> and befriends it, so these reach its NODE and   *
+     * its remove()/release() through self(). Members a backend never      *
+     * calls are never instantiated for it.                                */
+
+    const K& self() const noexcept { return *static_cast<const K*>( this ); }
+
+    void post_next() const noexcept { auto& obj = self().obj;
+        function_t<int> cb; obj->post.ack();
+        while( obj->post.pop( cb ) ){ obj->ev_queue.add( cb ); }
+    }
+
+    /*─······································································─*/
+
+    /* ready registrations are chained through kevent_t::ready, so a wakeup  *
+     * re-queues the kv node itself instead of allocating a dispatch task.   */
+
+    void ready_push( void* ptr ) const noexcept { auto& obj = self().obj;
+        obj->kv_queue.as( ptr )->data.ready = nullptr;
+        if( obj->kv_tail==nullptr ){ obj->kv_head = ptr; }
+        else { obj->kv_queue.as( obj->kv_tail )->data.ready = ptr; }
+        obj->kv_tail = ptr; ++obj->kv_ready;
+    }
+
+    void* ready_pop() const noexcept { auto& obj = self().obj;
+        void* ptr = obj->kv_head; if( ptr==nullptr ){ return nullptr; }
+        obj->kv_head = obj->kv_queue.as( ptr )->data.ready;
+        if( obj->kv_head==nullptr ){ obj->kv_tail = nullptr; }
+    --obj->kv_ready; return ptr; }
+
+    void ready_clear() const noexcept { auto& obj = self().obj;
+        obj->kv_head = obj->kv_tail = nullptr;
+        obj->kv_ready= obj->kv_round= 0;
+    }
+
+    /* drops a registration whose fd was closed and its number reused: the *
+     * poller already forgot it, so it only has to leave kv_queue.         */
+
+    void detach( void* ptr ) const noexcept {
+        if( ptr==nullptr ){ return; } auto& obj = self().obj;
+        auto kv = obj->kv_queue.as( ptr ); kv->data.flag |= K::FLAG::KV_STATE_ERASE;
+        obj->kv_timer.off( kv->data.timer ); kv->data.timer = nullptr;
+    self().release( kv ); }
+
+    /* a callback that returns 0 goes back to waiting on its fd; backends *
+     * whose registrations are one-shot re-arm it here ( see io_uring ).   */
+
+    bool rearm( void* /*unused*/ ) const noexcept { return true; }
+
+    int ready_next() const { auto& obj = self().obj;
+        if( obj->kv_ready==0 ){ obj->kv_round=0; return -1; }
+        if( obj->kv_round==0 ){ obj->kv_round = obj->kv_ready; }
+
+        auto y = obj->kv_queue.as( ready_pop() ); --obj->kv_round;
+        NODEPP_STATS( ulong t = process::micros(); )
+        int  c = y->data.flag & K::FLAG::KV_STATE_ERASE ? -1 : y->data.callback();
+        NODEPP_STATS( obj->st.add_task( process::micros()-t ); )
+        /*-----*/ coroutine::getno();
+
+        if( c==0 && y->data.flag & K::FLAG::KV_STATE_CLOSED ){ c=-1; }
+        if( c==1 && !( y->data.flag & K::FLAG::KV_STATE_ERASE ) ){ ready_push( y ); }
+        elif( c==0 && !( y->data.flag & K::FLAG::KV_STATE_ERASE ) && !self().rearm( y ) )
+            { ready_push( y ); }
+        else { y->data.flag &=~ K::FLAG::KV_STATE_USED; if( c==-1 ){ self().remove( y ); }
+        elif ( y->data.flag & K::FLAG::KV_STATE_ERASE ){ self().release( y ); }}
+    return obj->kv_round==0 ? -1 : 1; }
+
+    /*─······································································─*/
+
+    /* with a task budget set, queued tasks and ready fds keep running     *
+     * across rounds until the batch is spent, instead of polling after     *
+     * every round. A spent batch polls with a zero timeout; if that poll   *
+     * finds events the next batch is halved, otherwise it grows back.      */
+
+    bool batch_next() const { auto& obj = self().obj; auto& tb = obj->tb;
+
+        if( tb.limit==0 ){
+            while( obj->ev_queue.next( obj->kv_ready==0 ) >= 0 ){ return true; }
+            while( ready_next() /*-*/ >= 0 ){ return true; }
+        return false; }
+
+        if( tb.count==0 && tb.time>0 ){ tb.stamp = process::micros(); }
+        bool wait = obj->ev_queue.get_delay()==0 || obj->kv_ready>0;
+
+        if( !wait ){ tb.count=0; tb.full=false; return false; }
+        if( tb.count >= tb.task || ( tb.time>0 && process::micros()-tb.stamp >= tb.time ) )
+          { tb.full = true; return false; } ++tb.count;
+
+        while( obj->ev_queue.next( obj->kv_ready==0 ) >= 0 ){ return true; }
+        /*---*/ ready_next(); return true;
+    }
+
+    void batch_done( bool hit ) const noexcept { auto& tb = self().obj->tb;
+        if( tb.limit==0 || !tb.full ){ return; } tb.count=0; tb.full=false;
+        if( hit ){ tb.task = max( tb.limit/8+1, tb.task/2 ); }
+        else     { tb.task = min( tb.limit, tb.task*2 ); }
+    }
+
+    /*─······································································─*/
+
+    /* opt-in spin phase: peek() with a zero timeout for up to bp.budget µs *
+     * before blocking. A hit doubles the window and a miss halves it down  *
+     * to 0, so an idle loop stops spinning altogether. It opens again when *
+     * a blocking wait returns events within bp.limit µs: a spin would have *
+     * caught those.                                                        */
+
+    bool busy_spin() const noexcept { auto& obj = self().obj; auto& bp = obj->bp;
+        if( bp.budget==0 || obj->kv_queue.size()==0 ){ return false; }
+        long  tout = self().get_delay_ms(); if( tout==0 ){ return false; }
+        ulong stamp= process::micros() + ( tout<0 ? bp.budget : min( bp.budget, (ulong) tout*1000 ) );
+        int c=0; do { if(( c=self().peek() )>0 ){ ++bp.hit; bp.budget = min( bp.limit, bp.budget*2 ); return true; }
+        } while( c==0 && process::micros() < stamp );
+        ++bp.miss; bp.budget /= 2; return false;
+    }
+
+    bool busy_wait() const noexcept { auto& bp = self().obj->bp;
+        if( bp.limit>0 && busy_spin() ){ return true; } ++bp.sleep;
+        bp.stamp = bp.limit==0 ? 0 : process::micros(); return false;
+    }
+
+    void busy_done( bool hit ) const noexcept { auto& bp = self().obj->bp;
+        if( bp.stamp==0 ){ return; } if( hit && process::micros()-bp.stamp <= bp.limit )
+          { bp.budget = max( bp.budget, bp.limit/8+1 ); } bp.stamp = 0;
+    }
+
+public:
+
+    /* the only kernel_t calls that are safe from another thread: cb is  *
+     * queued in a lock-free inbox and added to the loop on its next     *
+     * wakeup. A burst of posts costs a single emit(). See loop_handle_t.*/
+
+    template< class T, class... V >
+    int post( T cb, const V&... args ) const noexcept { return self().obj->post.post( cb, args... ); }
+
+    post_box_t get_post() const noexcept { return self().obj->post; }
+
+    /*─······································································─*/
+
+    /* ring-fed sockets, see socket_t::set_feed(). A backend that accepts *
+     * and receives ahead of the reader ( io_uring ) stages the results   *
+     * per fd and hands them out here; -3 sends the socket back to plain  *
+     * accept()/recv(), which is all the other backends ever answer.      */
+
+    int feed_add   ( int /*unused*/, bool /*unused*/ ) const noexcept { return -1; }
+    int feed_off   ( int /*unused*/ ) /*-----------*/ const noexcept { return -1; }
+    int feed_accept( int /*unused*/ ) /*-----------*/ const noexcept { return -3; }
+    int feed_read  ( int /*unused*/, char* /*unused*/, ulong /*unused*/ ) const noexcept { return -3; }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
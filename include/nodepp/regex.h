@@ -282,11 +282,11 @@ protected:
 
 public:
 
-    regex_t (): obj( new NODE() ){}
+    regex_t (): obj( ptr::make<NODE>() ){}
 
    ~regex_t () noexcept { clear_memory(); }
 
-    regex_t ( const string_t& reg, bool icase=false ): obj( new NODE() )
+    regex_t ( const string_t& reg, bool icase=false ): obj( ptr::make<NODE>() )
     /*---*/ { obj->icase=icase; obj->queue=compile(reg); }
 
     /*─······································································─*/
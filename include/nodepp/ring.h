@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_RING
+#define NODEPP_RING
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class T > class ring_t {
+protected:
+
+    /* a deque over one power-of-two buffer: push and shift at both ends   *
+     * are an index update, and the buffer only doubles when it is full.   *
+     * Removed slots are reset to T() so they don't keep resources alive.  */
+
+    enum RING { RING_SIZE = 16 };
+
+    struct NODE {
+        ptr_t<T> buffer; ulong head=0, size=0;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    ulong index( ulong idx ) const noexcept {
+        return ( obj->head + idx ) & ( obj->buffer.size() - 1 );
+    }
+
+    void grow( ulong size ) const noexcept {
+        ulong cap = max( (ulong) RING_SIZE, obj->buffer.size() );
+        while( cap < size ){ cap *= 2; } if( cap == obj->buffer.size() ){ return; }
+
+        ptr_t<T> buffer( cap ); for( ulong x=0; x<obj->size; ++x )
+           { buffer[x] = obj->buffer[ index(x) ]; }
+        obj->buffer = buffer; obj->head = 0;
+    }
+
+    class NODE_ITER { public:
+        const ring_t* ring; ulong idx;
+        T&   operator* () const noexcept { return (*ring)[idx]; }
+        bool operator!=( const NODE_ITER& other ) const noexcept { return idx != other.idx; }
+        NODE_ITER& operator++() noexcept { ++idx; return *this; }
+    };
+
+public:
+
+    ring_t( ulong size ) noexcept : obj( ptr::make<NODE>() ) { grow( size ); }
+
+    ring_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+    /*─······································································─*/
+
+    T& operator[]( ulong idx ) const noexcept { return obj->buffer[ index(idx) ]; }
+
+    /*─······································································─*/
+
+    ulong capacity() const noexcept { return obj->buffer.size(); }
+    ulong     size() const noexcept { return obj->size; }
+    bool     empty() const noexcept { return obj->size==0; }
+
+    T&       first() const noexcept { return (*this)[0]; }
+    T&        last() const noexcept { return (*this)[ obj->size-1 ]; }
+
+    NODE_ITER begin() const noexcept { return { this, 0 }; }
+    NODE_ITER   end() const noexcept { return { this, obj->size }; }
+
+    /*─······································································─*/
+
+    void reserve( ulong size ) const noexcept { grow( size ); }
+
+    void push( const T& value ) const noexcept {
+        if( obj->size == obj->buffer.size() ){ grow( obj->size+1 ); }
+        obj->buffer[ index( obj->size ) ] = value; ++obj->size;
+    }
+
+    void unshift( const T& value ) const noexcept {
+        if( obj->size == obj->buffer.size() ){ grow( obj->size+1 ); }
+        obj->head = index( obj->buffer.size()-1 );
+        obj->buffer[ obj->head ] = value; ++obj->size;
+    }
+
+    void shift() const noexcept { if( empty() ){ return; }
+        obj->buffer[ obj->head ] = T(); obj->head = index(1); --obj->size;
+    }
+
+    void pop() const noexcept { if( empty() ){ return; }
+        obj->buffer[ index( obj->size-1 ) ] = T(); --obj->size;
+    }
+
+    void clear() const noexcept { while( !empty() ){ shift(); } obj->head=0; }
+
+    /*─······································································─*/
+
+    ptr_t<T> data() const noexcept {
+        if( empty() ){ return nullptr; } ptr_t<T> out( size() );
+        for( ulong x=0; x<size(); ++x ){ out[x] = (*this)[x]; } return out;
+    }
+
+    void map( function_t<void,T&> func ) const noexcept {
+        for( ulong x=0; x<size(); ++x ){ func( (*this)[x] ); }
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
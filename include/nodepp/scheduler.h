@@ -0,0 +1,254 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_SCHEDULER
+#define NODEPP_SCHEDULER
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include "os.h"
+#include "worker.h"
+#include "deque.h"
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class scheduler_t {
+private:
+
+    /* every thread runs its own kernel_t, so fd-bound work started there *
+     * stays on that thread. Tasks given to add() are CPU-only: they sit  *
+     * in the thread's deque_t and idle threads steal them from the top.  */
+
+    /* a thread's share of the loop: stolen and local tasks run for up to  *
+     * SCHEDULER_SLICE µs (checked every SCHEDULER_BATCH tasks) before the  *
+     * kernel gets to poll its fds again.                                   */
+
+    enum SCHEDULER {
+         SCHEDULER_BATCH = 64,
+         SCHEDULER_SLICE = 1000
+    };
+
+    /* a thread that finds no work marks itself SCHEDULER_IDLE and ends its *
+     * batch task, so its kernel blocks in the poller. push() flips one    *
+     * idle thread back to SCHEDULER_RUN and posts it a new batch task.    */
+
+    enum STATE {
+         SCHEDULER_START = 0,
+         SCHEDULER_RUN   = 1,
+         SCHEDULER_IDLE  = 2
+    };
+
+    using NODE_TASK = function_t<int>;
+
+    struct NODE_LOCAL { void* sign=nullptr; ulong idx=0, seed=0, gen=0; heap_t<void*> park; };
+
+protected:
+
+    struct NODE_THREAD {
+        atomic_t<int>   state;
+        ptr_t<kernel_t> krn;
+    };
+
+    struct NODE {
+        ptr_t<deque_t<void*>> deque;
+        ptr_t<NODE_THREAD>    thread;
+        queue_t<void*>  inject; mutex_t mut;
+        atomic_t<ulong> task, alive, queued, idle;
+        atomic_t<bool>  closed;
+        ptr_t<kernel_t> krn;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    static NODE_LOCAL& get_local() noexcept {
+        thread_local static NODE_LOCAL local; return local;
+    }
+
+    /*─······································································─*/
+
+    static bool resume( NODE_THREAD& self ) noexcept {
+        int state = SCHEDULER_IDLE; return self.state.compare( state, SCHEDULER_RUN );
+    }
+
+    static void wake( NODE* obj ) noexcept {
+        if( obj->idle.get()==0 ){ return; }
+        for( ulong x=0; x<obj->thread.size(); ++x ){ auto& y = obj->thread[x];
+        if ( !resume( y ) ){ continue; }
+             --obj->idle; y.krn->post( batch( obj, x ) ); return;
+        }
+    }
+
+    static void push( NODE* obj, void* address ) noexcept {
+        auto& local = get_local();
+        if( local.sign == obj && obj->deque[ local.idx ].push( address ) ){ wake( obj ); return; }
+        obj->mut.lock([&](){ obj->inject.push( address ); }); ++obj->queued; wake( obj );
+    }
+
+    static bool take( NODE* obj, void*& address ) noexcept {
+        if( obj->queued.get()==0 ){ return false; } bool done = false;
+        obj->mut.lock([&](){ if( obj->inject.empty() ){ return; }
+            address = obj->inject.first()->data; obj->inject.shift();
+            --obj->queued; done = true;
+        }); return done;
+    }
+
+    static bool steal( NODE* obj, ulong idx, void*& address ) noexcept {
+        auto& local = get_local(); ulong size = obj->deque.size();
+        local.seed ^= local.seed << 13; local.seed ^= local.seed >> 7;
+        local.seed ^= local.seed << 17; ulong start = local.seed % size;
+        for( ulong x=0; x<size; ++x ){ ulong y = ( start + x ) % size;
+        if ( y == idx ){ continue; }
+        if ( obj->deque[y].steal( address ) ){ return true; }
+        }    return false;
+    }
+
+    static bool has_work( NODE* obj ) noexcept {
+        if( obj->queued.get()>0 ){ return true; }
+        for( ulong x=0; x<obj->deque.size(); ++x ){
+        if ( obj->deque[x].size()>0 ){ return true; }
+        }    return false;
+    }
+
+    /*─······································································─*/
+
+    static void run( NODE* obj, void* address ) {
+        auto clb = (NODE_TASK*) address;
+        int  c = (*clb)(); auto z = coroutine::getno();
+
+        if( c==-1 ){ delete clb; 
+        if( --obj->task==0 && !obj->krn.null() ){ obj->krn->emit(); } return; }
+        if( z.flag & coroutine::STATE::CO_STATE_DELAY ){ 
+            get_local().park.push( process::now() + z.delay, address ); 
+        return; } push( obj, address );
+    }
+
+    /* the state is published before the last look for work, so a push()  *
+     * racing with it either is seen here or sees SCHEDULER_IDLE and wakes *
+     * this thread. Parked tasks keep the batch task alive on a delay.     */
+
+    static int sleep( NODE* obj, ulong idx, ulong stamp ) noexcept {
+        auto& self = obj->thread[idx]; auto& park = get_local().park;
+        self.state = SCHEDULER_IDLE; ++obj->idle;
+
+        if( obj->closed.get() ){ return -1; } if( has_work( obj ) ){
+        if( resume( self ) ){ --obj->idle; }
+        return 1; } if( park.empty() ){ return -1; }
+
+        coroutine::getno( 1, 0, max( 1UL, park.top().first - stamp ) );
+    return 1; }
+
+    static int run_batch( NODE* obj, ulong idx ) {
+        if( obj->closed.get() ){ return -1; } void* x=nullptr;
+        auto& self = obj->deque[idx]; auto& park = get_local().park;
+        ulong stamp= process::now(), n=0, time=process::micros();
+
+        if( resume( obj->thread[idx] ) ){ --obj->idle; }
+
+        while( !park.empty() && park.top().first <= stamp )
+             { push( obj, park.top().second ); park.pop(); }
+
+        while( self.pop( x ) || take( obj, x ) || steal( obj, idx, x ) ){ run( obj, x );
+        if   ( ++n % SCHEDULER_BATCH == 0 && process::micros()-time >= SCHEDULER_SLICE )
+             { return 1; }}
+
+    return sleep( obj, idx, stamp ); }
+
+    /* wake() may post a batch task while an older one still sits on a     *
+     * delay; the newest one to start takes over and the others end.      */
+
+    static NODE_TASK batch( NODE* obj, ulong idx ) noexcept {
+        ptr_t<ulong> gen = new ulong(0); return [=](){
+            auto& local = get_local(); if( *gen==0 ){ *gen = ++local.gen; }
+            if  ( *gen != local.gen ){ return -1; }
+        return run_batch( obj, idx ); };
+    }
+
+    /*─······································································─*/
+
+    /* threads only hold the raw NODE: the last scheduler_t going away     *
+     * closes and joins them before the NODE is released.                  */
+
+    void start( ulong idx ) const noexcept { auto self = obj.get();
+        worker::add([=](){
+            auto& local = get_local(); local.sign = self;
+            local.idx   = idx; local.seed = idx * 2654435761UL + 1;
+            self->thread[idx].krn   = type::bind( process::NODEPP_EV_LOOP() );
+            self->thread[idx].state = SCHEDULER_RUN;
+            process::add( batch( self, idx ) );
+            while( !self->closed.get() ){ process::next(); }
+            auto& park = get_local().park; while( !park.empty() ){ 
+            delete (NODE_TASK*) park.top().second; park.pop(); }
+            process::clear(); --self->alive;
+        return -1; });
+    }
+
+public:
+
+    scheduler_t( ulong threads=0 ) noexcept : obj( ptr::make<NODE>() ) {
+        if( threads==0 ){ threads = max( 1U, os::cpus() ); }
+        obj->deque  = ptr_t<deque_t<void*>>( threads );
+        obj->thread = ptr_t<NODE_THREAD>( threads );
+    }
+
+   ~scheduler_t() noexcept { if( obj.count() > 1 ){ return; } close(); }
+
+    /*─······································································─*/
+
+    ulong threads() const noexcept { return obj->deque.size(); }
+
+    ulong size() const noexcept { return obj->task.get(); }
+
+    bool empty() const noexcept { return size()==0; }
+
+    bool is_closed() const noexcept { return obj->closed.get(); }
+
+    /*─······································································─*/
+
+    template< class T, class... V >
+    void add( T cb, const V&... args ) const noexcept {
+        auto clb = type::bind( cb ); ++obj->task;
+        push( obj.get(), new NODE_TASK([=](){ return (*clb)( args... ); }) );
+    }
+
+    /*─······································································─*/
+
+    int emit() const noexcept {
+        if( obj->alive.get()>0 || obj->closed.get() ){ return 0; }
+        obj->krn = type::bind( process::NODEPP_EV_LOOP() );
+        for( ulong x=0; x<threads(); ++x ){ ++obj->alive; start( x ); }
+    return 1; }
+
+    int await() const noexcept { emit();
+        while( !empty() ){ process::next(); } close();
+    return 1; }
+
+    /* a thread still in SCHEDULER_START has not reached its loop yet and  *
+     * will see closed there; every other one gets a no-op post so that a  *
+     * thread blocked in its poller wakes up to notice.                     */
+
+    void close() const noexcept {
+        if( obj->closed.get() ){ return; } obj->closed = true;
+        for( ulong y=0; y<threads(); ++y ){ auto& z = obj->thread[y];
+        if ( z.state.get()!=SCHEDULER_START ){ z.krn->post([](){ return -1; }); }}
+        while( obj->alive.get()>0 ){ worker::delay( 1 ); } void* x=nullptr;
+        for( ulong y=0; y<threads(); ++y ){ obj->thread[y].krn.reset();
+        while( obj->deque[y].pop( x ) ){ delete (NODE_TASK*) x; }}
+        while( take( obj.get(), x ) ) /*----*/{ delete (NODE_TASK*) x; }
+        obj->task = 0; obj->krn.reset();
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
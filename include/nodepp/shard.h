@@ -0,0 +1,134 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_SHARD
+#define NODEPP_SHARD
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include "os.h"
+#include "tcp.h"
+#include "worker.h"
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class shard_t {
+private:
+
+    /* one listener per thread: every worker builds its own server through *
+     * the factory and binds it with SO_REUSEPORT, so the kernel spreads   *
+     * new connections across threads and no event_t crosses a thread.     */
+
+    struct NODE_STEER { uint cpu;
+        template< class T > void operator()( T sk ) const noexcept {
+    #ifdef SO_INCOMING_CPU
+        sk.set_incoming_cpu( cpu );
+    #endif
+    }};
+
+protected:
+
+    struct NODE {
+        ptr_t<ptr_t<kernel_t>> krn;
+        atomic_t<ulong> alive;
+        atomic_t<bool>  closed;
+        mutex_t mut;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    bool attach( ulong idx ) const noexcept { bool done=false;
+        obj->mut.lock([&](){ if( obj->closed.get() ){ return; }
+            obj->krn[idx] = type::bind( process::NODEPP_EV_LOOP() ); done=true;
+        }); return done;
+    }
+
+    void detach( ulong idx ) const noexcept {
+        obj->mut.lock([&](){ obj->krn[idx].reset(); }); --obj->alive;
+    }
+
+    /*─······································································─*/
+
+    template< class T >
+    void start( ulong idx, const string_t& host, int port, T factory, bool steer ) const noexcept {
+        auto self = type::bind( this ); ++obj->alive;
+        worker::add([=](){
+            if( !self->attach( idx ) ){ --self->obj->alive; return -1; }
+            if( steer ){ worker::affinity( idx % os::cpus() ); }
+
+            auto srv = (*factory)();
+            if( steer ){ srv.onOpen.once( NODE_STEER({ (uint)( idx % os::cpus() ) }) ); }
+            srv.listen( host, port );
+
+            while( !self->obj->closed.get() && !srv.is_closed() ){ process::next(); }
+            srv.close(); process::clear(); self->detach( idx );
+
+        return -1; });
+    }
+
+public:
+
+    template< class T >
+    shard_t( const string_t& host, int port, ulong threads, T factory, bool steer=false ) noexcept
+    : obj( ptr::make<NODE>() ) { auto clb = type::bind( factory );
+        if( threads==0 ){ threads = max( 1U, os::cpus() ); }
+        obj->krn = ptr_t<ptr_t<kernel_t>>( threads );
+        for( ulong x=0; x<threads; ++x ){ start( x, host, port, clb, steer ); }
+    }
+
+    shard_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+   ~shard_t() noexcept { if( obj.count() > 1 ){ return; } close(); }
+
+    /*─······································································─*/
+
+    ulong threads() const noexcept { return obj->krn.size(); }
+
+    ulong size() const noexcept { return obj->alive.get(); }
+
+    bool is_closed() const noexcept { return obj->closed.get() || size()==0; }
+
+    /*─······································································─*/
+
+    void close() const noexcept {
+        if( obj->closed.get() ){ return; }
+        obj->mut.lock([&](){ obj->closed = true;
+            for( ulong x=0; x<threads(); ++x ){
+            if ( !obj->krn[x].null() ){ obj->krn[x]->emit(); }}
+        }); while( obj->alive.get()>0 ){ worker::delay( 1 ); }
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace tcp {
+
+    /* starts `threads` workers (0 = one per core), each listening on      *
+     * host:port through its own server built by factory(). Handlers run   *
+     * concurrently, so anything they share must be thread safe. Works     *
+     * with any factory returning tcp_t or tls_t ( http::server, ws::...). */
+
+    template< class T >
+    shard_t cluster_listen( const string_t& host, int port, ulong threads, T factory, bool steer=false ){
+    return shard_t( host, port, threads, factory, steer ); }
+
+    template< class T >
+    shard_t cluster_listen( const string_t& host, int port, T factory ){
+    return shard_t( host, port, 0, factory, false ); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
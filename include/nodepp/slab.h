@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_SLAB
+#define NODEPP_SLAB
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include <new>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace slab {
+
+    /* per-thread free lists, one per SLAB_ALIGN-byte size class. Freed   *
+     * blocks are cached for reuse up to SLAB_LIMIT per class; past that *
+     * they go back to malloc, so a burst never pins memory for good. A  *
+     * block freed on another thread simply joins that thread's cache.   */
+
+    enum SLAB {
+         SLAB_ALIGN = 16,
+         SLAB_LIMIT = 1024
+    };
+
+    struct NODE_BLOCK { NODE_BLOCK* next; };
+
+    struct NODE_LIST {
+        NODE_BLOCK* head=nullptr; ulong size=0, limit=SLAB_LIMIT;
+       ~NODE_LIST() noexcept { while( head!=nullptr ){
+            auto x = head->next; ::free( head ); head = x;
+        }   size = limit = 0; }
+    };
+
+    /*─······································································─*/
+
+    template< ulong SIZE >
+    NODE_LIST& get_list() noexcept {
+        thread_local static NODE_LIST list; return list;
+    }
+
+    /*─······································································─*/
+
+    template< class T >
+    void* alloc() noexcept {
+        enum { CLASS = ( sizeof(T) + SLAB_ALIGN - 1 ) / SLAB_ALIGN };
+        auto& list = get_list<CLASS>(); if( list.head==nullptr )
+            { return ::malloc( CLASS * SLAB_ALIGN ); }
+        auto out   = list.head; list.head = out->next;
+        --list.size; return out;
+    }
+
+    template< class T >
+    void release( void* address ) noexcept {
+        enum { CLASS = ( sizeof(T) + SLAB_ALIGN - 1 ) / SLAB_ALIGN };
+        auto& list = get_list<CLASS>(); if( list.size >= list.limit )
+            { ::free( address ); return; }
+        auto x = (NODE_BLOCK*) address; x->next = list.head;
+        list.head = x; ++list.size;
+    }
+
+    /*─······································································─*/
+
+    template< class T, class... V >
+    T* make( const V&... args ){ return new( alloc<T>() ) T( args... ); }
+
+    template< class T >
+    void drop( T* address ) noexcept {
+        if( address==nullptr ){ return; } address->~T(); release<T>( address );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
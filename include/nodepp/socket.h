@@ -17,11 +17,13 @@
 #if   _KERNEL_ == NODEPP_KERNEL_WINDOWS
     #include "os.h"
     #include "limit.h"
+    #include "chain.h"
     #include "stream.h"
     #include "windows/socket.h"
 #elif _KERNEL_ == NODEPP_KERNEL_POSIX
     #include "os.h"
     #include "limit.h"
+    #include "chain.h"
     #include "stream.h"
     #include "posix/socket.h"
 #else
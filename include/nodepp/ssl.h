@@ -134,7 +134,7 @@ public:
     
     /*─······································································─*/
 
-    ssl_t( const string_t& _key, const string_t& _cert, const string_t& _chain ) : obj( new NODE() ) {
+    ssl_t( const string_t& _key, const string_t& _cert, const string_t& _chain ) : obj( ptr::make<NODE>() ) {
        if(!fs::exists_file(_key) || !fs::exists_file(_cert) || !fs::exists_file(_chain) )
          { throw except_t("such key, cert or chain does not exist"); } 
            obj->key = _key;  obj->crt = _cert; obj->cha = _chain;
@@ -144,7 +144,7 @@ public:
     
     /*─······································································─*/
 
-    ssl_t( const string_t& _key, const string_t& _cert ) : obj( new NODE() ) { 
+    ssl_t( const string_t& _key, const string_t& _cert ) : obj( ptr::make<NODE>() ) { 
        if(!fs::exists_file(_key) || !fs::exists_file(_cert) )
          { throw except_t("such key or cert does not exist"); }
            obj->key = _key; obj->crt = _cert; 
@@ -152,7 +152,7 @@ public:
 
     /*─······································································─*/
 
-    ssl_t( ssl_t xtc, int /*unused*/ ) : obj( new NODE() ) { 
+    ssl_t( ssl_t xtc, int /*unused*/ ) : obj( ptr::make<NODE>() ) { 
        if( xtc.get_ctx() == nullptr ){ throw except_t("ctx has no context"); }
         
         obj->ctx = xtc.get_ctx(); 
@@ -173,7 +173,7 @@ public:
 
     /*─······································································─*/
 
-    ssl_t() : obj( new NODE() ) {
+    ssl_t() : obj( ptr::make<NODE>() ) {
         thread_local static ptr_t< X509_t > cert; if( cert.null() ){
             cert= type::bind/*-*/( X509_t() ); 
             cert->generate("Node","Node","Node");
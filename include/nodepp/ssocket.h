@@ -35,18 +35,23 @@ public: ptr_t<ssl_t> ssl;
     /*─······································································─*/
 
     virtual int __read( char* bf, const ulong& sx ) const noexcept override {
-        if ( process::millis() > get_recv_timeout() || is_closed() )
+        if ( process::uptime() > get_recv_timeout() || is_closed() )
            { return -1; } if ( sx==0 ) { return  0; }
         if ( ssl.null() ) /*--------*/ { return -1; }
         obj->feof = ssl->_read( this, bf, sx ); return obj->feof;
     }
 
     virtual int __write( char* bf, const ulong& sx ) const noexcept override {
-        if ( process::millis() > get_send_timeout() || is_closed() )
+        if ( process::uptime() > get_send_timeout() || is_closed() )
            { return -1; } if ( sx==0 ) { return  0; } 
         if ( ssl.null() ) /*--------*/ { return -1; }
         obj->feof =ssl->_write( this, bf, sx ); return obj->feof;
     }
+
+    virtual int __writev( const buffer_chain_t& bf ) const noexcept override {
+        if( bf.empty() ){ return is_closed() ? -1 : 0; }
+        return __write( bf.first().data(), bf.first().size() );
+    }
     
 };}
 
@@ -73,7 +73,54 @@ namespace string {
 class string_t {
 protected:
 
-    ptr_t<char> buffer;
+    /* up to STRING_SSO-1 chars live inline in sso[] and are copied by    *
+     * value; longer strings, and strings built over an existing ptr_t,  *
+     * keep the shared buffer. len counts sso[] bytes with the NUL, and  *
+     * is 0 whenever buffer holds the string.                            */
+
+    enum STRING { STRING_SSO = 24 };
+
+    ptr_t<char> buffer; mutable char sso[STRING_SSO]; uchar len=0;
+
+    ulong _len_() const noexcept { return len!=0 ? len : buffer.size(); }
+    char* _ptr_() const noexcept { return len!=0 ? sso : &buffer; }
+
+    void _set_( ulong n ) noexcept {
+        if( n == 0 ){ buffer.reset(); len=0; return; }
+        if( n >= STRING_SSO ){ buffer = string::buffer( n ); len=0; return; }
+            buffer.reset(); memset( sso, 0, STRING_SSO ); len = n + 1;
+    }
+
+    void _set_( const char* c, ulong n ) noexcept {
+        _set_( n ); if( n!=0 ){ memcpy( _ptr_(), c, n ); }
+    }
+
+    /* a heap buffer may be longer than the string ( see reserve() ); it *
+     * is grown and shifted in place only while nobody else shares it.   */
+
+    bool _unique_() const noexcept { return len!=0 || buffer.count() <= 1; }
+
+    void _gap_( ulong index, ulong N ) noexcept {
+        ulong n = size(), m = n + N; 
+        
+        if( ( len!=0 || buffer.null() ) && m < STRING_SSO ){
+        if( len==0 ){ buffer.reset(); memset( sso, 0, STRING_SSO ); }
+            memmove( sso+index+N, sso+index, n-index ); 
+            sso[m] = '\0'; len = m + 1; return;
+        }
+
+        if( len!=0 || !_unique_() || m+1 > buffer.capacity() )
+          { reserve( max( m, n*2 ) ); }
+
+        buffer.slice( 0, m+1 ); auto x = begin();
+        memmove( x+index+N, x+index, n-index+1 );
+    }
+
+    void _cut_( ulong index, ulong N ) noexcept {
+        ulong n = size(); auto x = begin();
+        memmove( x+index, x+index+N, n-index-N+1 );
+        if( len!=0 ){ len -= N; } else { buffer.slice( 0, n-N+1 ); }
+    }
 
     ptr_t<ulong> get_slice_range( long x, long y ) const noexcept {
 
@@ -111,22 +158,31 @@ public:
 
     string_t() noexcept { buffer.clear(); }
 
+    string_t( const string_t& other ) noexcept : buffer( other.buffer ), len( other.len ) {
+        if( len!=0 ){ memcpy( sso, other.sso, len ); }
+    }
+
+    string_t& operator=( const string_t& other ) noexcept {
+        if( this == &other ){ return *this; } buffer = other.buffer; len = other.len;
+        if( len!=0 ){ memcpy( sso, other.sso, len ); } return *this;
+    }
+
     string_t( const char* argc ) noexcept {
         if( argc == nullptr ){
             buffer.clear(); return;
-        }   buffer = string::buffer( argc, strlen(argc) );
+        }   _set_( argc, strlen(argc) );
     }
 
     string_t( const ulong& n, const char& c ) noexcept {
         if( n == 0 ){
             buffer.clear(); return;
-        }   buffer = string::buffer( n, c );
+        }   _set_( n ); memset( _ptr_(), c, n );
     }
 
     string_t( const char* argc, const ulong& n ) noexcept {
         if( argc == nullptr || n == 0 ){
             buffer.clear(); return;
-        }   buffer = string::buffer( argc, n );
+        }   _set_( argc, n );
     }
 
     /*─······································································─*/
@@ -139,23 +195,40 @@ public:
 
     /*─······································································─*/
 
-    char*   end() const noexcept { return &buffer + size(); }
-    char* begin() const noexcept { return &buffer; }
+    char*   end() const noexcept { return _ptr_() + size(); }
+    char* begin() const noexcept { return _ptr_(); }
 
     /*─······································································─*/
 
     ulong first() const noexcept { return 0; }
-    bool  empty() const noexcept { return buffer.size() <= 1; }
-    ulong  size() const noexcept { return empty() ? 0 : buffer.size() - 1; }
-    ulong  last() const noexcept { return empty() ? 0 : buffer.size() - 2; }
+    bool  empty() const noexcept { return _len_() <= 1; }
+    ulong  size() const noexcept { return empty() ? 0 : _len_() - 1; }
+    ulong  last() const noexcept { return empty() ? 0 : _len_() - 2; }
+
+    ulong capacity() const noexcept {
+        return ( len!=0 || buffer.null() ) ? STRING_SSO - 1 : buffer.capacity() - 1;
+    }
+
+    /*─······································································─*/
+
+    void reserve( ulong n ) noexcept {
+        if( n < STRING_SSO && ( len!=0 || buffer.null() ) ){ return; }
+        if( len==0 && _unique_() && n+1 <= buffer.capacity() ){ return; }
+        ulong m = size(); auto n_buffer = ptr_t<char>( max( n, m ) + 1 );
+        if( m!=0 ){ memcpy( &n_buffer, begin(), m ); } n_buffer[m] = '\0';
+        n_buffer.slice( 0, m+1 ); buffer = n_buffer; len = 0;
+    }
+
+    void shrink_to_fit() noexcept {
+        if( len!=0 ) /*-*/ { return; } if( empty() ){ buffer.reset(); return; }
+        ulong n = size(); if( n < STRING_SSO ){ auto keep = buffer; _set_( &keep, n ); return; }
+        if( n+1 != buffer.capacity() ){ buffer = buffer.copy(); }
+    }
 
     /*─······································································─*/
 
     string_t operator+=( const string_t& oth ) noexcept {
-        if( oth.empty() ){ return *this; } auto slf=copy();
-        buffer = string::buffer( slf.size() + oth.size() );
-        memcpy( begin()+slf.size () ,oth.begin(), oth.size() ); 
-        memcpy( begin(),slf.begin() ,slf.size () ); return *this;
+        insert( size(), oth ); return *this;
     }
 
     /*─······································································─*/
@@ -170,7 +243,9 @@ public:
     bool operator==( const string_t& oth ) const noexcept { return compare( oth ) == 0; }
     bool operator!=( const string_t& oth ) const noexcept { return compare( oth ) != 0; }
 
-    char& operator[]( ulong n ) const noexcept { return buffer[n]; }
+    char& operator[]( ulong n ) const noexcept { 
+        if( len==0 ){ return buffer[n]; } return sso[ n<len ? n : n%len ];
+    }
 
     /*─······································································─*/
 
@@ -266,33 +341,27 @@ public:
         } return (*this);
     }
 
-    string_t copy() const noexcept { return buffer.copy(); }
+    string_t copy() const noexcept { 
+        if( len!=0 ){ return *this; } return buffer.copy(); 
+    }
 
     /*─······································································─*/
 
-    void fill( const char& argc ) const noexcept { buffer.fill(argc); }
+    void fill( const char& argc ) const noexcept { 
+        if( len!=0 ){ memset( sso, argc, len ); } else { buffer.fill(argc); }
+    }
 
     template< class... T >
-    void resize( T... args ) noexcept { buffer.resize(args...); }
+    void resize( T... args ) noexcept { len=0; buffer.resize(args...); }
 
     /*─······································································─*/
 
-    string_t sort( function_t<bool,char,char> func ) const noexcept {
-    queue_t<char> n_buffer; char* addr = begin();
-
-    while( addr != end() ){ auto x = *addr;
+    template< class F >
+    string_t sort( F func ) const noexcept {
+        string_t out( data(), size() ); algorithm::sort( out.begin(), out.size(), func ); return out;
+    }
 
-        if( n_buffer.empty() ) { n_buffer.push( x ); } else {
-        if( func( x, n_buffer.last()->data ) ) {
-            auto n = n_buffer.last();
-            while( n != nullptr && func( x, n->data ) ) { n= n->prev; }
-            n_buffer.insert( n==nullptr ? n_buffer.first() : n->next, x );
-        } else { n_buffer.push( x ); } }
-
-    ++addr; } 
-    
-           n_buffer.push('\0');
-    return n_buffer.data(/**/); }
+    string_t sort( function_t<bool,char,char> func ) const noexcept { return sort<function_t<bool,char,char>>( func ); }
 
     /*─······································································─*/
 
@@ -303,88 +372,59 @@ public:
 
     /*─······································································─*/
 
-    void clear() noexcept { buffer.reset(); }
-    void erase() noexcept { buffer.reset(); }
-    void  free() noexcept { buffer.reset(); }
+    void clear() noexcept { buffer.reset(); len=0; }
+    void erase() noexcept { buffer.reset(); len=0; }
+    void  free() noexcept { buffer.reset(); len=0; }
 
     /*─······································································─*/
 
     void insert( ulong index, const char& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer(1); buffer[0] = value; }
-        else { ulong n=size() + 1; auto n_buffer = string::buffer(n);
-            memcpy( &n_buffer+index+1, &buffer+index, buffer.size()-index );
-            memcpy( &n_buffer,         &buffer      , index );
-            n_buffer[index] = value; buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); char item = value;
+        _gap_( index, 1 ); begin()[index] = item;
     }
 
     void insert( ulong index, ulong N , char* value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( value, N ); }
-        else { ulong n=size() + N; auto n_buffer = string::buffer(n);
-            memcpy( &n_buffer+index+N, &buffer+index, buffer.size()-index );
-            memcpy( &n_buffer,         &buffer      , index );
-            memcpy( &n_buffer+index  ,  value       , N );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( value==nullptr || N==0 ){ return; }
+        string_t keep; if( value>=begin() && value<end() ){ keep = string_t( value, N ); value = keep.begin(); }
+        _gap_( index, N ); memcpy( begin()+index, value, N );
     }
 
     void insert( ulong index, ulong N , const char& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( N, value ); }
-        else{ ulong n=size() + N; auto n_buffer = string::buffer(n);
-            memcpy( &n_buffer+index+N, &buffer+index, buffer.size()-index );
-            memcpy( &n_buffer,         &buffer      , index );
-            memset( &n_buffer+index  ,  value       , N     );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N==0 ){ return; } char item = value;
+        _gap_( index, N ); memset( begin()+index, item, N );
     }
 
     void insert( ulong index, const string_t& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( value.size() );
-            memcpy( &buffer, value.begin(), value.size() );
-        } else { auto n_buffer = string::buffer( size() + value.size() );
-                 ulong N=value.size();
-            memcpy( &n_buffer+index+N, &buffer+index, buffer.size()-index );
-            memcpy( &n_buffer,         &buffer      , index );
-            memcpy( &n_buffer+index  , value.begin(), N );
-            buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( value.empty() ){ return; } 
+        string_t item = value; ulong N = item.size();
+        _gap_( index, N ); memcpy( begin()+index, item.begin(), N );
     }
 
     template< ulong N >
     void insert( ulong index, const char (&value)[N] ) noexcept {
 	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( N ); memcpy( &buffer, value, N );
-        } else { ulong n=size() + N; auto n_buffer = string::buffer( n );
-            memcpy( &n_buffer+index+N, &buffer+index, (buffer.size()-index) );
-            memcpy( &n_buffer,         &buffer      , index );
-            memcpy( &n_buffer+index  , &value       , N );
-            buffer = n_buffer;
-        }
+        _gap_( index, N ); memcpy( begin()+index, &value, N );
     }
 
     /*─······································································─*/
 
     void erase( ulong index ) noexcept {
 	    auto r = get_slice_range( index, size() );
-        if ( r.null() ){ return; } else {
-            auto n_buffer = string::buffer( size() - 1 );
-            memcpy( &n_buffer+r[0], &buffer+r[0]+1, size()-r[0]-1 );
-            memcpy( &n_buffer     , &buffer       , r[0] );
-            buffer = n_buffer;
+        if ( r.null() ){ return; } elif( _unique_() ){ _cut_( r[0], 1 ); } else {
+            string_t n_buffer; n_buffer._set_( size() - 1 );
+            memcpy( n_buffer.begin()+r[0], begin()+r[0]+1, size()-r[0]-1 );
+            memcpy( n_buffer.begin()     , begin()       , r[0] );
+            *this = n_buffer;
         }
     }
 
     void erase( ulong start, ulong stop  ) noexcept {
 	    auto r = get_slice_range( start, stop );
-        if ( r.null() ){ return; } else {
-            auto n_buffer = string::buffer( size() - r[2] );
-            memcpy( &n_buffer+r[0], &buffer+r[1]+1, size()-r[1]-1 );
-            memcpy( &n_buffer     , &buffer       , r[0] );
-            buffer = n_buffer;
+        if ( r.null() ){ return; } elif( _unique_() ){ _cut_( r[0], r[2] ); } else {
+            string_t n_buffer; n_buffer._set_( size() - r[2] );
+            memcpy( n_buffer.begin()+r[0], begin()+r[1]+1, size()-r[1]-1 );
+            memcpy( n_buffer.begin()     , begin()       , r[0] );
+            *this = n_buffer;
         }
     }
 
@@ -406,13 +446,13 @@ public:
 
     string_t slice_view( long start, long stop ) const noexcept {
 	    auto r = get_slice_range( start, stop  );
-        if ( r.null() ){ return nullptr; } 
+        if ( r.null() ){ return nullptr; } if( len!=0 ){ return slice( start, stop ); }
         return ptr_t<char>( buffer, r[0], r[0]+r[2]+1 );
     }
 
     string_t slice_view( long start ) const noexcept {
 	    auto r = get_slice_range( start, size() );
-        if ( r.null() ){ return nullptr; } 
+        if ( r.null() ){ return nullptr; } if( len!=0 ){ return slice( start ); }
         return ptr_t<char>( buffer, r[0], r[0]+r[2]+1 );
     }
 
@@ -423,7 +463,7 @@ public:
         auto r = get_slice_range( start, size() );
         if ( r.null() ){ return nullptr; }
         
-        auto   n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto   n_buffer = string_t( begin()+r[0], r[2] );
         return n_buffer;
 
     }
@@ -433,7 +473,7 @@ public:
         auto r = get_slice_range( start, stop );
         if ( r.null() ){ return nullptr; }
 
-        auto   n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto   n_buffer = string_t( begin()+r[0], r[2] );
         return n_buffer;
     }
 
@@ -444,7 +484,7 @@ public:
         auto r = get_splice_range( start, stop );
         if ( r.null() ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( begin()+r[0], r[2] );
         erase( r[0], r[0]+r[2] ); return n_buffer;
     }
 
@@ -453,7 +493,7 @@ public:
         auto r = get_splice_range( start, stop );
         if ( r.null() ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( begin()+r[0], r[2] );
         erase( r[0], r[0]+r[2] ); insert( r[0], value ); return n_buffer;
     }
 
@@ -461,7 +501,7 @@ public:
 
     string_t to_capital_case() const noexcept {
         if ( empty() ){ return nullptr; } bool b=1;
-        auto out=string::buffer( size() );
+        string_t out; out._set_( size() );
         auto y=out.begin(); auto x=begin();
         while( x != end() ){
            if( string::is_alpha(*x) && b==1 ){ *y=string::to_upper(*x); b=0; goto DONE; }
@@ -470,22 +510,22 @@ public:
     }
 
     string_t to_slugify() const noexcept { if( empty() ){ return nullptr; } 
-        auto out=string::buffer( size() ); ulong z=1; /*------*/
+        string_t out; out._set_( size() ); ulong z=1; /*------*/
         auto y=out.begin(); auto x=begin(); while( x != end() ){ 
               if (!string::is_alnum(*x) ){ goto DONE; }
             else { *y = string::to_lower(*x); ++z; }
-        DONE:; ++x; ++y; } return string_t( &out,z );
+        DONE:; ++x; ++y; } return string_t( out.begin(),z );
     }
 
     string_t to_lower_case() const noexcept { if( empty() ){ return nullptr; } 
-        auto out=string::buffer( size() ); /*-----------------*/
+        string_t out; out._set_( size() ); /*-----------------*/
         auto y=out.begin(); auto x=begin(); while( x != end() ){ 
             *y=string::to_lower(*x); 
         ++x; ++y; } return out;
     }
 
     string_t to_upper_case() const noexcept { if ( empty() ){ return nullptr; } 
-        auto out=string::buffer( size() ); /*-----------------*/
+        string_t out; out._set_( size() ); /*-----------------*/
         auto y=out.begin(); auto x=begin(); while( x != end() ){ 
             *y=string::to_upper(*x); 
         ++x; ++y; } return out;
@@ -493,14 +533,16 @@ public:
 
     /*─······································································─*/
 
-    explicit operator char* (void) const noexcept { return empty() ? nullptr : &buffer; }
+    explicit operator char* (void) const noexcept { return empty() ? nullptr : _ptr_(); }
     explicit operator bool  (void) const noexcept { return empty(); }
     
-          char*  data() const noexcept { return empty() ? nullptr : &buffer; }
-          char*   get() const noexcept { return empty() ? nullptr : &buffer; }
-    const char* c_str() const noexcept { return empty() ? nullptr : &buffer; }
+          char*  data() const noexcept { return empty() ? nullptr : _ptr_(); }
+          char*   get() const noexcept { return empty() ? nullptr : _ptr_(); }
+    const char* c_str() const noexcept { return empty() ? nullptr : _ptr_(); }
 
-    ptr_t<char>&  ptr()       noexcept { return buffer; }
+    ptr_t<char>&  ptr()       noexcept { 
+        if( len!=0 ){ buffer = string::buffer( sso, len-1 ); len=0; } return buffer; 
+    }
 
 };
 
@@ -508,13 +550,13 @@ public:
 
 inline string_t operator+( const string_t& A, const string_t& B ){
     if( A.empty() ){ return B; } if( B.empty() ){ return A; }
-    string_t C = string::buffer( A.size() + B.size() );
+    string_t C ( A.size() + B.size(), '\0' );
     memcpy( C.get()+ A.size(), B.get(), B.size() );
     memcpy( C.get(), A.get() , A.size() ); return C;
 }
 
 inline string_t operator^( const string_t& A, const string_t& B ){
-    string_t C = string::buffer( A.size() );
+    string_t C ( A.size(), '\0' );
     char *a=A.begin(), *b=B.begin(), *c=C.begin();
     while( c != C.end() ){ *c = *a ^ *b;
     ++a; ++b; ++c; } return C;
@@ -22,6 +22,12 @@ namespace nodepp { struct TASK_STATE { enum TYPE {
     CLOSED  = 0b00000100,
 };};}
 
+namespace nodepp { struct TASK_PRIORITY { enum TYPE {
+    HIGH    = 0,
+    NORMAL  = 1,
+    IDLE    = 2
+};};}
+
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { struct POLL_STATE { enum FLAG {
@@ -33,4 +39,54 @@ namespace nodepp { struct POLL_STATE { enum FLAG {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { struct busy_poll_t {
+    ulong limit=0, budget=0; /* spin window in µs: ceiling and current size  */
+    ulong hit  =0, miss  =0; /* spins that found events / ran out of budget  */
+    ulong sleep=0, stamp =0; /* waits that fell through to the blocking call */
+}; }
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { struct task_budget_t {
+    ulong limit=0, task =0;  /* batch ceiling and current size, 0 disables it */
+    ulong time =0, stamp=0;  /* µs per batch (0: no limit), batch start in µs */
+    ulong count=0; bool full=false;
+}; }
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifdef NODEPP_LOOP_STATS
+    #define NODEPP_STATS(...) __VA_ARGS__
+#else
+    #define NODEPP_STATS(...)
+#endif
+
+/* counters stay zero unless built with NODEPP_LOOP_STATS; queue sizes are   *
+ * always filled. histogram[x] counts callbacks that ran for less than      *
+ * 16µs << (2*x), the last bucket holds everything slower.                  */
+
+namespace nodepp { struct loop_stats_t {
+    ulong iteration=0, task=0;         /* loop_t::next() calls, callbacks run    */
+    ulong wakeup=0, event=0;           /* kernel waits that returned, their fds  */
+    ulong timer=0, lag=0, lag_max=0;   /* delayed tasks woken, ms past deadline  */
+    ulong ev_queue=0, kv_queue=0, blocked=0;
+    ulong stamp=0, elapsed=0;          /* millis() at loop start, ms since then  */
+    ulong histogram[8] {};
+
+    void add_task( ulong time ) noexcept { ulong x=0; ++task;
+        while( x<7 && time>=( 16UL<<( x*2 ) ) ){ ++x; } ++histogram[x];
+    }
+
+    void add_lag( ulong time ) noexcept { ++timer; lag += time;
+        if( time > lag_max ){ lag_max = time; }
+    }
+
+    void merge( const loop_stats_t& other ) noexcept {
+        task   += other.task;   wakeup += other.wakeup; event += other.event;
+        for( ulong x=0; x<8; ++x ){ histogram[x] += other.histogram[x]; }
+    }
+}; }
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 #endif
@@ -46,12 +46,12 @@ public:
 
     /*─······································································─*/
 
-    tcp_t( NODE_CLB _func, agent_t* opt=nullptr ) noexcept : obj( new NODE() )
+    tcp_t( NODE_CLB _func, agent_t* opt=nullptr ) noexcept : obj( ptr::make<NODE>() )
          { obj->func=_func; obj->agent=opt==nullptr ? agent_t() : *opt; }
 
    ~tcp_t() noexcept { if( obj.count() > 1 ){ return; } free(); }
 
-    tcp_t() noexcept : obj( new NODE() ) {}
+    tcp_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
@@ -83,7 +83,7 @@ public:
             close(); sk.free(); return; 
         }   
         
-        auto self=type::bind( this );
+        auto self=type::bind( this ); sk.set_feed();
         cb( sk );  onOpen.emit( sk );
         sk.onDrain.once([=](){ self->close(); });
         
@@ -95,7 +95,7 @@ public:
             return -1; }
 
             auto cli   = socket_t(c);
-            cli.set_sockopt( self->obj->agent );
+            cli.set_sockopt( self->obj->agent ); cli.set_feed();
             auto _read = type::bind( generator::file::read() );
 
         process::poll( cli, POLL_STATE::READ | POLL_STATE::EDGE, [=](){
@@ -35,7 +35,7 @@ protected:
         agent_t  agent ;
     };  ptr_t<NODE> obj;
 
-public: udp_t() noexcept : obj( new NODE() ) {}
+public: udp_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     event_t<socket_t>         onConnect;
     event_t<socket_t>         onSocket;
@@ -45,7 +45,7 @@ public: udp_t() noexcept : obj( new NODE() ) {}
 
     /*─······································································─*/
 
-    udp_t( agent_t* opt=nullptr ) noexcept : obj( new NODE() )
+    udp_t( agent_t* opt=nullptr ) noexcept : obj( ptr::make<NODE>() )
          { obj->agent=opt==nullptr ? agent_t() : *opt; }
 
    ~udp_t() noexcept { if( obj.count() > 1 ){ return; } free(); }
@@ -33,7 +33,7 @@ protected:
 
 public:
 
-    wait_t() noexcept : obj( new NODE() ) {}
+    wait_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_WHEEL
+#define NODEPP_WHEEL
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class wheel_t {
+private:
+
+    /* hashed timing wheel: every slot covers WHEEL_TICK ms, deadlines further *
+     * than one full turn stay in their slot until the cursor reaches them.   */
+
+    enum WHEEL {
+         WHEEL_SIZE = 512,
+         WHEEL_MASK = 511,
+         WHEEL_TICK = 16
+    };
+
+    struct NODE_TASK { ulong stamp; ulong slot; void* data; };
+
+protected:
+
+    /* hint is the earliest tick known to hold a deadline. add() can only  *
+     * move it closer; once its slot is emptied or passed it is dropped and *
+     * the next get_delay() scans for it again, instead of on every call.  */
+
+    struct NODE {
+        ptr_t<queue_t<NODE_TASK>> slot;
+        ulong tick=0, length=0, hint=0;
+        void* iter=nullptr; bool fresh=false;
+    };  ptr_t<NODE> obj;
+
+    /*─······································································─*/
+
+    queue_t<NODE_TASK>& get_slot( ulong tick ) const noexcept {
+        return obj->slot[ tick & WHEEL_MASK ];
+    }
+
+public:
+
+    wheel_t() noexcept : obj( ptr::make<NODE>() ) {
+        obj->slot.resize( WHEEL_SIZE );
+        obj->tick = process::now() / WHEEL_TICK;
+    }
+
+    /*─······································································─*/
+
+    ulong size() const noexcept { return obj->length; }
+
+    bool empty() const noexcept { return obj->length==0; }
+
+    void clear() const noexcept {
+        for( auto& x: obj->slot ){ x.clear(); }
+        obj->length=0; obj->iter=nullptr; obj->fresh=false;
+    }
+
+    /*─······································································─*/
+
+    void* add( ulong stamp, void* data ) const noexcept {
+        ulong tick = max( stamp / WHEEL_TICK, obj->tick );
+        auto& slot = get_slot( tick ); /*--------------*/
+        slot.push({ stamp, tick & WHEEL_MASK, data });
+        if  ( obj->length==0 ){ obj->hint = tick; obj->fresh = true; }
+        elif( obj->fresh /**/ ){ obj->hint = min( obj->hint, tick ); }
+    ++obj->length; return (void*) slot.last(); }
+
+    void off( void* address ) const noexcept {
+        if( address == nullptr ){ return; }
+        auto slot = obj->slot[0].as( address )->data.slot;
+        auto& que = obj->slot[ slot ]; auto x = que.as( address );
+        if( !que.is_valid( x ) ){ return; }
+        if( obj->iter == address ){ obj->iter = x->next; }
+        que.erase( x ); --obj->length; if( que.empty() && 
+            slot == ( obj->hint & WHEEL_MASK ) ){ obj->fresh = false; }
+    }
+
+    /*─······································································─*/
+
+    int get_delay() const noexcept { if( empty() ){ return -1; }
+        ulong stamp = process::now(); ulong cur = stamp / WHEEL_TICK;
+
+        if( !obj->fresh ){ obj->hint = cur + WHEEL_SIZE - 1;
+        for( ulong x=0; x<WHEEL_SIZE; ++x ){
+        if ( get_slot( cur + x ).empty() ){ continue; }
+             obj->hint = cur + x; break;
+        }    obj->fresh = true; }
+
+        if( obj->hint < cur ){ return 0; }
+    return min( ( obj->hint + 1 ) * WHEEL_TICK - stamp, (ulong) WHEEL_SIZE * WHEEL_TICK ); }
+
+    /*─······································································─*/
+
+    template< class T >
+    ulong next( ulong stamp, T cb ) const noexcept {
+        if( empty() ){ obj->tick = stamp / WHEEL_TICK; return 0; }
+
+        ulong cur = stamp / WHEEL_TICK, out = 0;
+        ulong len = min( cur - obj->tick + 1, (ulong) WHEEL_SIZE );
+
+        for( ulong z=0; z<len; ++z ){ auto& slot = get_slot( obj->tick + z );
+        auto x = slot.first(); while( x != nullptr ){ obj->iter = x->next;
+        if ( x->data.stamp < stamp ){ void* data = x->data.data;
+             slot.erase( x ); --obj->length; ++out; cb( data ); }
+        x = slot.as( obj->iter ); }}
+
+        if( obj->hint <= cur ){ obj->fresh = false; }
+    obj->iter = nullptr; obj->tick = cur; return out; }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
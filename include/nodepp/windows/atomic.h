@@ -44,11 +44,11 @@ public:
 
 public:
 
-    bool compare( T& expected, T desired ) const noexcept { switch( sizeof( T ) ){
+    bool compare( T& expected, T desired ) const noexcept { T prev; switch( sizeof( T ) ){
         case 2 : case 4 :
-        default: return (T)( ::InterlockedCompareExchange  ( (LONG   volatile *)&value, (LONG)  desired, (LONG)  expected ) ); break;
-        case 8 : return (T)( ::InterlockedCompareExchange64( (LONG64 volatile *)&value, (LONG64)desired, (LONG64)expected ) ); break;
-    }}
+        default: prev = (T)( ::InterlockedCompareExchange  ( (LONG   volatile *)&value, (LONG)  desired, (LONG)  expected ) ); break;
+        case 8 : prev = (T)( ::InterlockedCompareExchange64( (LONG64 volatile *)&value, (LONG64)desired, (LONG64)expected ) ); break;
+    }   if( prev == expected ){ return true; } expected = prev; return false; }
 
     T swap( T new_val ) noexcept { switch( sizeof( T ) ){
         case 2 : case 4 :
@@ -64,6 +64,7 @@ protected:
         generator::file::line  _line ;
         generator::file::read  _read ;
         generator::file::write _write;
+        generator::file::writev _writev;
     };  ptr_t<NODE> obj;
     
     /*─······································································─*/
@@ -125,20 +126,20 @@ public:
     
     /*─······································································─*/
 
-    file_t( const string_t& path, const string_t& mode, const ulong& _size=CHUNK_SIZE ) : obj( new NODE() ) {
+    file_t( const string_t& path, const string_t& mode, const ulong& _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) {
         auto fg = get_fd_flag( mode ); obj->fd = CreateFileA( path.c_str(), fg[0], fg[1], NULL, fg[2], fg[3], NULL ); 
         if( obj->fd == INVALID_HANDLE_VALUE ){ throw except_t("such file or directory does not exist"); }
         set_nonbloking_mode(); set_buffer_size( _size ); 
     }
 
-    file_t( const HANDLE& fd, const ulong& _size=CHUNK_SIZE ) : obj( new NODE() ) {
+    file_t( const HANDLE& fd, const ulong& _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) {
         if( fd == INVALID_HANDLE_VALUE ){ throw except_t("such file or directory does not exist"); }
         obj->fd = fd; set_nonbloking_mode(); set_buffer_size( _size ); 
     }
  
    ~file_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
 
-    file_t() noexcept : obj( new NODE() ) {}
+    file_t() noexcept : obj( ptr::make<NODE>() ) {}
 
     /*─······································································─*/
 
@@ -248,11 +249,18 @@ public:
              { process::next(); }
         return obj->_write.data;
     }
+
+    ulong write( const buffer_chain_t& msg ) const noexcept {
+        while( obj->_writev( this, msg ) == 1 )
+             { process::next(); }
+        return obj->_writev.data;
+    }
     
     /*─······································································─*/
 
     virtual int _read ( char* bf, const ulong& sx ) const noexcept { return __read ( bf, sx ); }
     virtual int _write( char* bf, const ulong& sx ) const noexcept { return __write( bf, sx ); }
+    virtual int _writev( const buffer_chain_t& bf ) const noexcept { return __writev( bf ); }
     
     /*─······································································─*/
 
@@ -296,6 +304,14 @@ public:
 
     return ( obj->feof <= 0 && obj->feof != -2 ) ? -1 : obj->feof; }
 
+    /* WriteFileGather() wants page-sized, page-aligned buffers, so a   *
+     * chain goes out one slice at a time.                              */
+
+    virtual int __writev( const buffer_chain_t& bf ) const noexcept {
+        if( bf.empty() ){ return is_closed() ? -1 : 0; }
+        return __write( bf.first().data(), bf.first().size() );
+    }
+
     /*─······································································─*/
 
     int _write_( char* bf, const ulong& sx, ulong* sy ) const noexcept {
@@ -25,10 +25,14 @@
 #include <winsock2.h>
 #include <mswsock.h>
 #include "../loop.h"
+#include "../wheel.h"
+#include "../reactor.h"
 
-namespace nodepp { class kernel_t {
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
 private:
 
+    friend class reactor_t<kernel_t>;
+
     using HPOLLFD = OVERLAPPED_ENTRY;
 
     enum FLAG { 
@@ -38,11 +42,12 @@ private:
          KV_STATE_EDGE    = 0b10000000,
          KV_STATE_USED    = 0b00000100,
          KV_STATE_AWAIT   = 0b00001100,
-         KV_STATE_CLOSED  = 0b00001000
+         KV_STATE_CLOSED  = 0b00001000,
+         KV_STATE_ERASE   = 0b00100000
     };
 
     struct kevent_t { public:
-        function_t<int> callback;
+        function_t<int> callback; void* timer; void* ready;
         ulong timeout; HANDLE fd; int flag; 
     };
 
@@ -58,12 +63,11 @@ protected:
 
         if( kv.flag==0x00 || is_std( kv.fd ) ){ return nullptr; }
 
-        auto tm = obj->kv_queue.as( get_nearest_timeout( kv.timeout ) );
-        /*-----*/ obj->kv_queue.insert( tm, kv );
-        auto id = tm==nullptr ? obj->kv_queue.last(): tm->prev;
+        /*-----*/ obj->kv_queue.push( kv ); auto id = obj->kv_queue.last();
+        id->data.timer = kv.timeout==0 ? nullptr : obj->kv_timer.add( kv.timeout, id );
 
         if( !CreateIoCompletionPort( id->data.fd, obj->pd, (ULONG_PTR)id, 0 ) ) 
-          { obj->kv_queue.erase(id); return nullptr; }
+          { obj->kv_timer.off( id->data.timer ); obj->kv_queue.erase(id); return nullptr; }
 
     iocp_execute_callback( id ); return (void*)id; }
 
@@ -71,21 +75,17 @@ protected:
         
         if( ptr == nullptr ){ return -1; } 
         auto kv = obj->kv_queue.as( ptr ); 
-        obj->kv_queue.erase( kv );
-        
-    return 0; }
-
-    /*─······································································─*/
-
-    void* get_nearest_timeout( ulong time ) const noexcept {
-        if( time == 0 ){ return nullptr; }
+        if( kv->data.flag & FLAG::KV_STATE_ERASE ){ return release( kv ); }
+            kv->data.flag|= FLAG::KV_STATE_ERASE;
 
-        auto x = obj->kv_queue.first(); while( x!=nullptr ){
-        if( 0   ==x->data.timeout ){ return x; }
-        if( time<=x->data.timeout ){ return x; }
-        x = x->next; }
+        obj->kv_timer.off( kv->data.timer ); kv->data.timer=nullptr;
+        
+    return release( kv ); }
 
-    return nullptr; }
+    int release( void* ptr ) const noexcept {
+        auto kv = obj->kv_queue.as( ptr );
+        if( kv->data.flag & FLAG::KV_STATE_USED ){ return 0; }
+    obj->kv_queue.erase( kv ); return 0; }
 
     /*─······································································─*/
 
@@ -94,29 +94,25 @@ protected:
 
         if( address == nullptr ) { return; } auto y = address;
         if( y->data.flag & FLAG::KV_STATE_USED ){ return; }
-            y->data.flag|= FLAG::KV_STATE_USED;
-
-        obj->ev_queue.add( coroutine::add( COROUTINE(){
-        coBegin
-
-            do { switch( y->data.callback() ) {
-            case -1: remove(y); /*---------------------*/ coEnd; break;
-            case  0: y->data.flag&=~ FLAG::KV_STATE_USED; coEnd; break;
-            case  1: break; } coNext; } while(1);
-
-        coFinish
-        }));
+            y->data.flag|= FLAG::KV_STATE_USED; ready_push( y );
 
     }
     
     /*─······································································─*/
 
     int get_delay_ms() const noexcept { 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
-        ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
+        ulong tasks= obj->ev_queue.size() + obj->kv_ready + obj->probe.get();
+        ulong time = TIMEOUT==0 ? !obj->tb.full : TIMEOUT;
+        long  tout = obj->kv_timer.get_delay(); /*-*/
         if(( tasks==0 && obj->kv_queue.size()>0 ) || 
            ( tasks==0 && obj.count()         >1 ) 
-        ) { return -1; } return time;
+        ) { return tout; } return tout<0 ? time : min( time, (ulong) tout );
+    }
+
+    /* one zero-timeout poll for busy_wait(): 1 if completions were read.  */
+
+    int peek() const noexcept {
+        return GetQueuedCompletionStatusEx( obj->pd, obj->ev.data(), obj->ev.size(), &obj->idx, 0, FALSE ) ? 1 : 0;
     }
 
 protected:
@@ -124,29 +120,39 @@ protected:
     struct NODE {
         loop_t /*------*/ ev_queue;
         queue_t<kevent_t> kv_queue;
+        wheel_t /*-----*/ kv_timer;
         probe_t /*-----*/ probe;
+        post_box_t /*--*/ post;
         ptr_t<HPOLLFD>    ev;
+        void *kv_head=nullptr, *kv_tail=nullptr;
+        ulong kv_ready=0, kv_round=0;
+        busy_poll_t bp; task_budget_t tb;
+        NODEPP_STATS( loop_stats_t st; )
         HANDLE pd; ULONG idx;
     };  ptr_t<NODE> obj;
 
 public:
 
-    kernel_t() : obj( new NODE() ) {
+    kernel_t() : obj( ptr::make<NODE>() ) {
+        obj->kv_queue.set_slab( true );
         obj->pd = CreateIoCompletionPort( INVALID_HANDLE_VALUE, NULL, 0, 0 );
         if( obj->pd == NULL ){ throw except_t("Can't Initialize kernel_t"); }
         obj->ev.resize( MAX_PATH );
+
+        HANDLE pd = obj->pd; obj->post.set_wake([=](){
+        return PostQueuedCompletionStatus( pd, 0, 0, NULL ) ? 1 : -1; });
     }
 
    ~kernel_t() noexcept { 
         if( obj.count() > 1 ) return; 
-        CloseHandle( obj->pd ); 
+        obj->post.close(); CloseHandle( obj->pd ); 
     }
 
 public:
 
-    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj.count()-1; }
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->kv_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
 
-    void clear() const noexcept { /*--*/ obj->ev_queue.clear(); obj->kv_queue.clear(); obj->probe.clear(); }
+    void clear() const noexcept { ready_clear(); obj->ev_queue.clear(); obj->kv_queue.clear(); obj->kv_timer.clear(); obj->probe.clear(); }
 
     bool empty() const noexcept { return size()==0; }
 
@@ -194,10 +200,30 @@ public:
 
     /*─······································································─*/
 
-    int emit() const noexcept {
-        return PostQueuedCompletionStatus( obj->pd, 0, 0, NULL ) ? 1 : -1;
+    void set_budget( ulong task, ulong time=0 ) const noexcept {
+         obj->tb.limit = obj->tb.task = task; obj->tb.time = time; 
+         obj->tb.count = 0; obj->tb.full = false;
     }
 
+    task_budget_t get_budget() const noexcept { return obj->tb; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong time ) const noexcept { obj->bp.limit = obj->bp.budget = time; }
+
+    busy_poll_t get_busy_poll() const noexcept { return obj->bp; }
+
+    /*─······································································─*/
+
+    loop_stats_t get_stats() const noexcept {
+        auto out = obj->ev_queue.get_stats(); out.kv_queue = obj->kv_queue.size();
+        NODEPP_STATS( out.merge( obj->st ); )
+    return out; }
+
+    /*─······································································─*/
+
+    int emit() const noexcept { return obj->post.emit(); }
+
     /*─······································································─*/
 
     template< class T, class... V > 
@@ -215,25 +241,27 @@ public:
 
     inline int next() const {
 
-        while( obj->ev_queue.next() == 1 ){ return 1; } 
-        process::set_timeout(obj->ev_queue.get_delay());
+        while( batch_next() ){ return 1; }
+        process::set_timeout( obj->kv_ready>0 ? 0 : obj->ev_queue.get_delay() );
 
-        auto stamp = process::now();
-
-        do   { auto x=obj->kv_queue.first(); while( x != nullptr ){
-               auto y=x->next; if( x->data.timeout==0 ) { break; }
-        if   ( x->data.flag & TASK_STATE::USED ){ x=y; continue; }
-        if   ( x->data.timeout < stamp ){ remove(x); }
-        else { break; } x=y; }} while(0);
+        obj->kv_timer.next( process::now(), [&]( void* address ){
+            auto x = obj->kv_queue.as( address ); x->data.timer = nullptr;
+        if( x->data.flag & FLAG::KV_STATE_USED ){ x->data.flag |= FLAG::KV_STATE_CLOSED; }
+        else /*-------------------------------*/{ remove( x ); }
+        });
 
+        if( !busy_wait() ){
         if( !GetQueuedCompletionStatusEx( 
              obj->pd , obj->ev .data(), obj->ev.size(), 
             &obj->idx, get_delay_ms (), FALSE )
-        ) { return 1; }
+        ) { obj->idx = 0; }}  process::get_clock( true );
+        NODEPP_STATS( ++obj->st.wakeup; obj->st.event += obj->idx; )
+        busy_done( obj->idx>0 );
+        batch_done( obj->idx>0 );
           
         while( obj->idx > 0 ){ obj->idx--; auto x = obj->ev[ obj->idx ];
 
-            if( x.lpCompletionKey==(ULONG_PTR)NULL ){ continue; }
+            if( x.lpCompletionKey==(ULONG_PTR)NULL ){ post_next(); continue; }
 
             auto y = obj->kv_queue.as  ( (void*) x.lpCompletionKey );
             if( !obj->kv_queue.is_valid( y ) ) /**/ { continue; }
@@ -251,9 +279,11 @@ public:
 
 #ifdef NODEPP_POLL_NPOLL
 
-namespace nodepp { class kernel_t {
+namespace nodepp { class kernel_t : public reactor_t<kernel_t> {
 private:
 
+    friend class reactor_t<kernel_t>;
+
     enum FLAG { 
          KV_STATE_UNKNONW = 0b00000000, 
          KV_STATE_WRITE   = 0b00000001,
@@ -271,11 +301,12 @@ private:
 
     /*─······································································─*/
 
+    /* nothing here can wake a sleeping loop, so while handles can post  *
+     * to it the loop naps 1ms at a time instead of waiting on TIMEOUT.   */
+
     int get_delay_ms() const noexcept { 
-        ulong tasks= obj->ev_queue.size() + obj->probe.get();
         ulong time = TIMEOUT==0 ? 1 : TIMEOUT; /*-*/
-        if(( tasks==0 && obj.count() > 1 ) 
-        ) { return -1; } return time;
+        if( obj.count() > 1 || obj->post.handles() > 0 ){ return 1; } return time;
     }
 
 protected:
@@ -283,11 +314,14 @@ protected:
     struct NODE {
         probe_t   probe;
         loop_t ev_queue;
+        post_box_t /*--*/ post;
     };  ptr_t<NODE> obj;
 
 public:
 
-    kernel_t() noexcept : obj( new NODE() ) {}
+    kernel_t() noexcept : obj( ptr::make<NODE>() ) {}
+
+   ~kernel_t() noexcept { if( obj.count() > 1 ){ return; } obj->post.close(); }
 
 public:
 
@@ -301,13 +335,25 @@ public:
 
     /*─······································································─*/
 
-    ulong size() const noexcept { return obj->ev_queue.size() + obj->probe.get() + obj.count()-1; }
+    ulong size() const noexcept { return obj->ev_queue.size() + obj->probe.get() + obj->post.size() + obj->post.handles() + obj.count()-1; }
 
     void clear() const noexcept { /*--*/ obj->ev_queue.clear(); obj->probe.clear(); }
 
     bool empty() const noexcept { return size()==0; }
 
-    int   emit() const noexcept { return -1; }
+    int   emit() const noexcept { return  0; }
+
+    /*─······································································─*/
+
+    void set_busy_poll( ulong /*unused*/ ) const noexcept {}
+
+    busy_poll_t get_busy_poll() const noexcept { return busy_poll_t(); }
+
+    void set_budget( ulong /*unused*/, ulong /*unused*/=0 ) const noexcept {}
+
+    task_budget_t get_budget() const noexcept { return task_budget_t(); }
+
+    loop_stats_t get_stats() const noexcept { return obj->ev_queue.get_stats(); }
 
     /*─······································································─*/
 
@@ -342,10 +388,11 @@ public:
 
     inline int next() const {
 
-        while( obj->ev_queue.next() == 1 ){ return 1; }
+        if( !obj->post.empty() ){ post_next(); }
+        while( obj->ev_queue.next() >= 0 ){ return 1; }
         process::set_timeout(obj->ev_queue.get_delay());
         process::delay( get_delay_ms() );
-        process::clear_timeout();
+        process::get_clock( true ); process::clear_timeout();
 
     return 1; }
 
@@ -26,6 +26,11 @@ namespace nodepp { namespace worker {
     inline DWORD  pid(){ return GetCurrentThreadId(); }
     inline void  exit(){ ExitThread(0); }
 
+    inline int affinity( ulong cpu ){
+        DWORD_PTR mask = (DWORD_PTR)1 << cpu;
+        return SetThreadAffinityMask( GetCurrentThread(), mask )!=0 ? 1 : -1;
+    }
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -40,7 +45,7 @@ protected:
 
 public:
 
-    mutex_t() : obj( new NODE() ) {
+    mutex_t() : obj( ptr::make<NODE>() ) {
         obj->fd   = CreateMutex( NULL, 0, NULL );
         if( obj->fd == NULL )
           { throw except_t("Cant Start Mutex"); }
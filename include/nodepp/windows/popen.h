@@ -112,18 +112,18 @@ public:
     event_t<string_t>  onDerr;
 
     popen_t( const string_t& path, const initializer_t<string_t>& args, const initializer_t<string_t>& envs )
-    : obj( new NODE() ) { _init_( path, args, envs ); }
+    : obj( ptr::make<NODE>() ) { _init_( path, args, envs ); }
 
     popen_t( const string_t& path, const initializer_t<string_t>& args )
-    : obj( new NODE() ) { _init_( path, args, nullptr ); }
+    : obj( ptr::make<NODE>() ) { _init_( path, args, nullptr ); }
 
     popen_t( const string_t& path ) 
-    : obj( new NODE() ) { auto cmd = regex::match_all( path, "[^ ]+" );
+    : obj( ptr::make<NODE>() ) { auto cmd = regex::match_all( path, "[^ ]+" );
         if ( cmd.empty() ){ throw except_t("invalid command"); }
         _init_( cmd[0], cmd.slice(1), nullptr );
     }
 
-    popen_t() noexcept : obj( new NODE() ) {}
+    popen_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~popen_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOfficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_WINDOWS_SEMAPHORE
+#define NODEPP_WINDOWS_SEMAPHORE
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include <windows.h>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class semaphore_t {
+protected:
+
+    struct NODE {
+        atomic_t<bool> alive=1;
+        HANDLE /*-*/ fd;
+    };  ptr_t<NODE> obj;
+
+public:
+
+    semaphore_t( ulong count=0 ) : obj( ptr::make<NODE>() ) {
+        obj->fd   = CreateSemaphore( NULL, (LONG) count, LONG_MAX, NULL );
+        if( obj->fd == NULL )
+          { throw except_t("Cant Start Semaphore"); }
+            /*-----------------*/ obj->alive=1;
+    }
+
+    virtual ~semaphore_t() noexcept {
+        if( obj->alive == 0 ){ return; }
+        if( obj.count() > 1 ){ return; }
+    free(); }
+
+    /*─······································································─*/
+
+    void free() const noexcept {
+         if( obj->alive == 0 ){ return; }
+             obj->alive =  0; CloseHandle( obj->fd );
+    }
+
+    /*─······································································─*/
+
+    void post() const noexcept {
+        if( obj->alive == 0 ){ return; }
+        ReleaseSemaphore( obj->fd, 1, NULL );
+    }
+
+    void wait() const noexcept {
+        if( obj->alive == 0 ){ return; }
+        WaitForSingleObject( obj->fd, INFINITE );
+    }
+
+    /* false once time ms pass without a post */
+
+    bool wait( ulong time ) const noexcept {
+        if( obj->alive == 0 ){ return false; }
+        return WaitForSingleObject( obj->fd, (DWORD) time )==WAIT_OBJECT_0;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -44,6 +44,36 @@ namespace nodepp { namespace process {
         return interval.time.QuadPart / 10000000; 
     }
 
+    /* monotonic ms, so deadlines survive NTP steps and manual clock      *
+     * changes. Read on every call; now() is its cached per-loop copy.    */
+
+    inline ulong uptime(){ 
+        thread_local static LARGE_INTEGER freq {}; LARGE_INTEGER time;
+        if( freq.QuadPart==0 ){ QueryPerformanceFrequency( &freq ); }
+        QueryPerformanceCounter( &time ); 
+        ulong f = freq.QuadPart, t = time.QuadPart;
+        return ( t / f ) * 1000 + ( t % f ) * 1000 / f; 
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    /* loop clock: uptime(), refreshed by the kernel once per iteration     *
+     * right after its poll returns, so every timer in that round shares a  *
+     * single clock read. A thread that never refreshed it reads uptime()   *
+     * on every call instead. Code that spins without polling must check    *
+     * its deadlines against uptime(), since now() won't move there.        */
+
+    inline ulong& get_clock( bool update=false ) {
+    thread_local static ulong stamp=0; thread_local static bool live=false;
+        if( update || !live ){ live |= update; stamp = uptime(); }
+    return stamp; }
+
+    inline ulong now(){ return get_clock(); }
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -73,8 +103,6 @@ namespace nodepp { namespace process {
 
     inline void yield(){ delay(TIMEOUT); }
 
-    inline ulong now(){ return millis(); }
-
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
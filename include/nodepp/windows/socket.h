@@ -43,6 +43,7 @@ struct agent_t {
     ulong conn_timeout  = 1000;
     ulong recv_timeout  = 0;
     ulong send_timeout  = 0;
+    ulong busy_poll     = 0;
     bool  reuse_address = 1;
     bool  no_delay_mode = 0;
     bool  reuse_port    = 1;
@@ -112,6 +113,7 @@ protected:
         generator::file::line  _line ;
         generator::file::read  _read ;
         generator::file::write _write;
+        generator::file::writev _writev;
     };  ptr_t<NODE> obj;
 
     /*─······································································─*/
@@ -157,22 +159,22 @@ public:
     /*─······································································─*/
 
     ulong get_recv_timeout() const noexcept {
-        return obj->recv_timeout==0 ? process::millis() : obj->recv_timeout;
+        return obj->recv_timeout==0 ? process::uptime() : obj->recv_timeout;
     }
 
     ulong get_send_timeout() const noexcept {
-        return obj->send_timeout==0 ? process::millis() : obj->send_timeout;
+        return obj->send_timeout==0 ? process::uptime() : obj->send_timeout;
     }
 
     ulong get_conn_timeout() const noexcept {
-        return obj->conn_timeout==0 ? process::millis() : obj->conn_timeout;
+        return obj->conn_timeout==0 ? process::uptime() : obj->conn_timeout;
     }
 
     /*─······································································─*/
 
     ulong set_conn_timeout( ulong time ) const noexcept {
         if( time == 0 ){ obj->conn_timeout = 0; return 0; }
-        obj->conn_timeout = process::millis() + time; 
+        obj->conn_timeout = process::uptime() + time; 
         return time;
     }
 
@@ -180,14 +182,14 @@ public:
         if( time == 0 ){ obj->recv_timeout = 0; return 0; }
         TIMEVAL en; memset( &en, 0, sizeof(en) ); en.tv_sec = time / 1000; en.tv_usec = 0;
     int c= setsockopt( obj->fd, SOL_SOCKET, SO_RCVTIMEO, (char*)&en, sizeof(en) ); 
-        obj->recv_timeout = process::millis() + time; return c==0 ? time : 0;
+        obj->recv_timeout = process::uptime() + time; return c==0 ? time : 0;
     }
 
     ulong set_send_timeout( ulong time ) const noexcept {
         if( time == 0 ){ obj->send_timeout = 0; return 0; }
         TIMEVAL en; memset( &en, 0, sizeof(en) ); en.tv_sec = time / 1000; en.tv_usec = 0;
     int c= setsockopt( obj->fd, SOL_SOCKET, SO_SNDTIMEO, (char*)&en, sizeof(en) ); 
-        obj->send_timeout = process::millis() + time; return c==0 ? time : 0;
+        obj->send_timeout = process::uptime() + time; return c==0 ? time : 0;
     }
 
     /*─······································································─*/
@@ -420,14 +422,14 @@ public:
 
     /*─······································································─*/
 
-    socket_t( SOCKET fd, ulong _size=CHUNK_SIZE ) : obj( new NODE() ) { _socket_::start_device();
+    socket_t( SOCKET fd, ulong _size=CHUNK_SIZE ) : obj( ptr::make<NODE>() ) { _socket_::start_device();
         if( fd == INVALID_SOCKET ){ throw except_t("Such Socket has an Invalid fd"); }
         obj->fd = fd; set_nonbloking_mode(); set_buffer_size(_size);
     }
 
     virtual ~socket_t() noexcept { if( obj.count()>1 && !is_closed() ){ return; } free(); }
 
-    socket_t() noexcept : obj( new NODE() ) { _socket_::start_device(); }
+    socket_t() noexcept : obj( ptr::make<NODE>() ) { _socket_::start_device(); }
 
     /*─······································································─*/
 
@@ -491,7 +493,7 @@ public:
 
     int _connect() const noexcept { 
 
-        if( process::millis() > get_conn_timeout() )/**/{ return -1; }
+        if( process::uptime() > get_conn_timeout() )/**/{ return -1; }
         if( obj->srv==1 || obj->lpfnConnectEx==nullptr ){ return -1; } DWORD c=0;
 
         if( obj->state & STATE::FS_STATE_READING ){
@@ -536,6 +538,11 @@ public:
         
     return -1; }
 
+    /* see posix socket_t::set_feed(): IOCP already completes reads into *
+     * the socket's own overlapped buffers, so there is nothing to hand. */
+
+    int set_feed() const noexcept { return -1; }
+
     /*─······································································─*/
 
     int listen() const noexcept { if( obj->srv == 0 ){ return -1; }
@@ -590,15 +597,22 @@ public:
         return obj->_write.data;
     }
 
+    ulong write( const buffer_chain_t& msg ) const noexcept {
+        while( obj->_writev( this, msg ) == 1 )
+             { process::next(); }
+        return obj->_writev.data;
+    }
+
     /*─······································································─*/
 
     virtual int _read ( char* bf, const ulong& sx ) const noexcept { return __read ( bf, sx ); }
     virtual int _write( char* bf, const ulong& sx ) const noexcept { return __write( bf, sx ); }
+    virtual int _writev( const buffer_chain_t& bf ) const noexcept { return __writev( bf ); }
 
     /*─······································································─*/
 
     virtual int __read( char* bf, const ulong& sx ) const noexcept {
-        if( process::millis() > get_recv_timeout() || is_closed() )
+        if( process::uptime() > get_recv_timeout() || is_closed() )
           { return -1; } if ( sx==0 ) { return 0; } DWORD c=0, f=0; 
 
         if( obj->state & STATE::FS_STATE_READING ){
@@ -623,7 +637,7 @@ public:
     return ( obj->feof <= 0 && obj->feof != -2 ) ? -1 : obj->feof; }
 
     virtual int __write( char* bf, const ulong& sx ) const noexcept {
-        if( process::millis() > get_send_timeout() || is_closed() )
+        if( process::uptime() > get_send_timeout() || is_closed() )
           { return -1; } if ( sx==0 ) { return 0; } DWORD c=0, f=0; 
 
         if( obj->state & STATE::FS_STATE_WRITING ){
@@ -647,6 +661,35 @@ public:
 
     return ( obj->feof <= 0 && obj->feof != -2 ) ? -1 : obj->feof; }
 
+    virtual int __writev( const buffer_chain_t& bf ) const noexcept {
+        if( process::uptime() > get_send_timeout() || is_closed() )
+          { return -1; } if ( bf.empty() ) { return 0; } DWORD c=0, f=0; 
+
+        if( obj->state & STATE::FS_STATE_WRITING ){
+        if( is_blocked( true, c ) ){ return -2; }
+            obj->state&=~ STATE::FS_STATE_WRITING;
+            obj->feof  = c==0 ? -1 : (int) c; 
+        return obj->feof; }
+
+        WSABUF wbuf[ buffer_chain_t::CHAIN_IOV ]; DWORD n=0;
+        auto x = bf.get_queue().first(); while( x!=nullptr && n<buffer_chain_t::CHAIN_IOV ){
+             wbuf[n].buf = x->data.data(); wbuf[n].len = x->data.size(); ++n; x = x->next;
+        }
+
+        memset( &obj->ovw, 0, sizeof(WSAOVERLAPPED) );
+        obj->state |= STATE::FS_STATE_WRITING;
+
+        int res = SOCK != SOCK_DGRAM
+                ? WSASend  ( obj->fd, wbuf, n, &c, 0, &obj->ovw , NULL )
+                : WSASendTo( obj->fd, wbuf, n, &c, 0, get_addr(), obj->len, &obj->ovw, NULL );
+
+        if( res==0 ) {
+            obj->state&=~ STATE::FS_STATE_WRITING;
+            obj->feof  = c==0 ? -1: (int) c;
+        } elif( is_blocked( c ) ) { obj->feof = -2; return -2; } 
+
+    return ( obj->feof <= 0 && obj->feof != -2 ) ? -1 : obj->feof; }
+
     /*─······································································─*/
 
     int _write_( char* bf, const ulong& sx, ulong* sy ) const noexcept {
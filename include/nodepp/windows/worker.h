@@ -48,7 +48,7 @@ protected:
             worker::delay( info.delay ); 
         } else { 
             worker::yield();
-        }}
+        }   process::get_clock( true ); }
 
     self->obj->state = STATE::WK_STATE_CLOSE; 
     self->obj->krn->emit(); /**/ delete self; 
@@ -57,14 +57,14 @@ protected:
 public:
 
     template< class T, class... V >
-    worker_t( T cb, const V&... arg ) noexcept : obj( new NODE() ){
+    worker_t( T cb, const V&... arg ) noexcept : obj( ptr::make<NODE>() ){
         auto clb = type::bind(cb);
         obj->cb  = function_t<int>([=](){ return (*clb)(arg...); });
     }
     
     /*─······································································─*/
 
-    worker_t() noexcept : obj( new NODE ) {}
+    worker_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~worker_t() noexcept { if( obj.count()>1 ){ return; } free(); }
     
@@ -151,7 +151,7 @@ protected:
             worker::delay( info.delay ); 
         } else { 
             worker::yield();
-        }}
+        }   process::get_clock( true ); }
 
     self->obj->state = STATE::WK_STATE_CLOSE;
     worker::exit(); return 0; }
@@ -159,14 +159,14 @@ protected:
 public:
 
     template< class T, class... V >
-    worker_t( T cb, const V&... arg ) noexcept : obj( new NODE() ){
+    worker_t( T cb, const V&... arg ) noexcept : obj( ptr::make<NODE>() ){
         auto clb = type::bind(cb);
         obj->cb  = function_t<int>([=](){ return (*clb)(arg...); });
     }
     
     /*─······································································─*/
 
-    worker_t() noexcept : obj( new NODE ) {}
+    worker_t() noexcept : obj( ptr::make<NODE>() ) {}
 
    ~worker_t() noexcept { if( obj.count()>1 ){ return; } free(); }
     
@@ -32,7 +32,7 @@ protected:
 public:
 
     template< class... T >
-    wss_t( const T&... args ) noexcept : ssocket_t( args... ), ws( new NODE() ){}
+    wss_t( const T&... args ) noexcept : ssocket_t( args... ), ws( ptr::make<NODE>() ){}
 
     virtual int _write( char* bf, const ulong& sx ) const noexcept override {
         if( is_closed() ){ return -1; } if( sx==0 ){ return  0; }
@@ -40,6 +40,11 @@ public:
         return ws->write.data==0 ? -1 : ws->write.data;
     }
 
+    virtual int _writev( const buffer_chain_t& bf ) const noexcept override {
+        if( bf.empty() ){ return is_closed() ? -1 : 0; }
+        return _write( bf.first().data(), bf.first().size() );
+    }
+
     virtual int _read ( char* bf, const ulong& sx ) const noexcept override {
         if( is_closed() ){ return -1; } if( sx==0 ){ return  0; }
         while( ws->read( this, bf, sx )==1 )/*---*/{ return -2; }
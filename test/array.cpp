@@ -132,6 +132,32 @@ namespace TEST { namespace ARRAY {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 13 | array capacity", [](){
+            try { array_t<int> arr; arr.reserve( 100 );
+             if ( arr.capacity() < 100 || !arr.empty() ){ throw 0; }
+                  for( int x=0; x<1000; x++ ){ arr.push( x ); }
+             if ( arr.size() != 1000 || arr[999] != 999 ){ throw 0; }
+                  auto cpy = arr; arr.push( 1000 ); arr.erase( 0 );
+             if ( cpy.size() != 1000 || cpy[0] != 0 ){ throw 0; }
+             if ( arr.size() != 1000 || arr[0] != 1 ){ throw 0; }
+                  arr.shrink_to_fit();
+             if ( arr.capacity() != arr.size() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 14 | array large sorting", [](){
+            try { array_t<ulong> arr ( 100000UL, 0UL ); ulong seed = 7;
+                  for( auto& x: arr ){ seed = seed * 6364136223846793005UL + 1; x = ( seed >> 33 ) % 1000; }
+                  auto fast = arr.sort([=]( ulong a, ulong b ){ return a<=b; });
+                  auto keep = arr.stable_sort([=]( ulong a, ulong b ){ return a%10 < b%10; });
+             for( ulong x=1; x<arr.size(); ++x ){
+             if ( fast[x] < fast[x-1] || keep[x]%10 < keep[x-1]%10 ){ throw 0; } }
+             if ( keep[0] != arr[ arr.index_of([=]( ulong a ){ return a%10==0; }) ] ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
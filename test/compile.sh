@@ -10,4 +10,5 @@ if [ ! $? -eq 0 ]; then
     echo "exit error"; exit;
 fi
 
-./build/main
\ No newline at end of file
+./build/main
+./build/main_stats
@@ -38,6 +38,22 @@ namespace TEST { namespace FILE {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 4 | file write chain", [](){
+            try { string_t body ( 40000, 'x' ); buffer_chain_t msg;
+                  msg.push( "hello " ); msg.push( body ); msg.push( " world" );
+            if  ( msg.count()!=3 || msg.size()!=40012 ){ throw 0; }
+
+                { file_t file( "test_chain", "w" ); if( file.write( msg )!=40012 ){ throw 0; } }
+            if  ( msg.size()!=40012 ){ throw 0; } msg.consume( 10 );
+            if  ( msg.count()!=2 || msg.first().size()!=39996 || msg.read( 3 )!="xxx" ){ throw 0; }
+
+                  file_t file( "test_chain", "r" ); auto data = file.read();
+                  fs::remove_file( "test_chain" );
+            if  ( data.size()!=40012 || data.slice( 0, 7 )!="hello x" || !data.ends_with( "world" ) )
+                { throw 0; }  TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
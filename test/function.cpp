@@ -4,6 +4,15 @@
 
 using namespace nodepp;
 
+int FUNC_TWICE( int x ){ return x * 2; }
+
+struct FUNC_UNIQUE { ptr_t<int> value;
+    FUNC_UNIQUE( int x ) : value( new int(x) ) {}
+    FUNC_UNIQUE( FUNC_UNIQUE&& other ) : value( other.value ) { other.value = nullptr; }
+    FUNC_UNIQUE( const FUNC_UNIQUE& ) = delete;
+    int operator()() const { return *value; }
+};
+
 namespace TEST { namespace FUNCTION {
 
     void TEST_RUNNER(){
@@ -32,6 +41,41 @@ namespace TEST { namespace FUNCTION {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 3 | function pointer", [](){
+            try {
+                function_t<int,int> clb ( &FUNC_TWICE ); int(*none)(int) = nullptr;
+             if ( clb.empty() || clb(2) != 4 ){ throw 0; }
+             if ( !function_t<int,int>( none ).empty() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | function inline and heap", [](){
+            try {
+                ptr_t<int> a = new int(1); char big[128] = { 2 };
+                function_t<int> small ([=](){ return *a; });
+                function_t<int> large ([=](){ return (int) big[0]; });
+                function_t<int> copy1 = small, copy2 = large;
+             if ( copy1() != 1 || copy2() != 2 || large.count() != 2 ){ throw 0; }
+                large.free(); small.free();
+             if ( !copy2.empty() || copy2() != 0 || copy1() != 1 ){ throw 0; }
+                copy1 = copy2;
+             if ( !copy1.empty() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 5 | unique function", [](){
+            try {
+                unique_function_t<int> clb ( FUNC_UNIQUE(7) );
+                unique_function_t<int> out ( type::move(clb) );
+             if ( !clb.empty() || out() != 7 ){ throw 0; }
+                clb = type::move(out);
+             if ( !out.empty() || clb() != 7 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -0,0 +1,65 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+namespace TEST { namespace HEAP {
+
+    void TEST_RUNNER(){
+        ptr_t<uint> totl = new uint(0);
+        ptr_t<uint> done = new uint(0);
+        ptr_t<uint> err  = new uint(0);
+        ptr_t<uint> skp  = new uint(0);
+
+        auto test = TEST_CREATE();
+
+        TEST_ADD( test, "TEST 1 | heap initialization", [](){
+            try { heap_t<uint> arr;
+             if ( !arr.empty()    ){ throw 0; }
+                  arr.push( 90, 9 ); arr.push( 10, 1 ); arr.push( 50, 5 );
+             if ( arr.size() != 3 ){ throw 0; }
+             if ( arr.top().first  != 10 ){ throw 0; }
+             if ( arr.top().second !=  1 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 2 | heap ordering", [](){
+            try { heap_t<uint> arr; ulong prev=0;
+                  for( uint x=0; x<1000; x++ ){ arr.push( ( x*7919 ) % 1000, x ); }
+                  while( !arr.empty() ){
+             if ( arr.top().first < prev ){ throw 0; }
+                  prev = arr.top().first; arr.pop(); }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | heap stable ties", [](){
+            try { heap_t<uint> arr;
+                  for( uint x=0; x<100; x++ ){ arr.push( 10, x ); }
+                  for( uint x=0; x<100; x++ ){
+             if ( arr.top().second != x ){ throw 0; } arr.pop(); }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | heap clearing", [](){
+            try { heap_t<uint> arr; arr.push( 10, 1 ); arr.clear();
+             if ( !arr.empty() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        test.onClose.once([=](){
+            console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
+        });
+
+        test.onDone([=](){ (*done)++; (*totl)++; });
+        test.onFail([=](){ (*err)++;  (*totl)++; });
+        test.onSkip([=](){ (*skp)++;  (*totl)++; });
+
+        TEST_AWAIT( test );
+
+    }
+
+}}
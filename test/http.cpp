@@ -1,6 +1,7 @@
 #include <nodepp/nodepp.h>
 //#include <nodepp/https.h>
 #include <nodepp/http.h>
+#include <nodepp/shard.h>
 #include <nodepp/test.h>
 
 using namespace nodepp;
@@ -101,6 +102,70 @@ namespace TEST { namespace HTTP {
         });
         */
 
+        TEST_ADD( test, "TEST 5 | HTTP cluster listen", [](){
+            try { ptr_t<int> x = new int(0);
+
+                auto srv = tcp::cluster_listen( "localhost", 8911, 2, [](){
+                    return http::server([=]( http_t cli ){
+                        cli.write_header( 200, header_t({ { "content-type", "text/plain" } }) );
+                        cli.write( "shard" );
+                    });
+                });
+
+                fetch_t args;
+                        args.url    = "http://localhost:8911";
+                        args.method = "GET";
+
+                process::add( coroutine::add( COROUTINE(){
+                coBegin ; coDelay( 100 );
+
+                    http::fetch( args )
+                   .then([=]( http_t cli ){ *x = cli.status==200 ? 1 : 2; })
+                   .fail([=]( except_t ){ *x = -1; });
+
+                coFinish
+                }));
+
+                while( *x==0 ){ process::next(); } srv.close();
+               switch( *x ){
+                    case 1: TEST_DONE(); break;
+                    case 2: TEST_FAIL(); break;
+                   default: TEST_SKIP(); break;
+                }
+                              TEST_FAIL();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 6 | HTTP stalled header", [](){
+            try { auto x = type::bind( atomic_t<int>(0) );
+
+                /* the server spins on the unfinished header until conn_timeout; *
+                 * that loop must get past it for the 1500ms timer to fire.      */
+
+                worker::add([=](){ ptr_t<int> y = new int(0); tcp_t cln = tcp::client();
+
+                    auto srv = http::server([=]( http_t cli ){ *y = 2; cli.close(); });
+                    srv.listen( "localhost", 8912, [=]( socket_t ){
+                        cln.onConnect([=]( socket_t cli ){ cli.write( "GET / HTTP/1.1\r\nHost: x\r\n" ); });
+                        cln.connect( "localhost", 8912 );
+                    });
+
+                    process::add( coroutine::add( COROUTINE(){
+                    coBegin ; coDelay( 1500 ); if( *y==0 ){ *y = 1; } coFinish
+                    }));
+
+                    while( *y==0 ){ process::next(); } 
+                    srv.close(); cln.close(); process::clear(); *x = *y;
+
+                return -1; });
+
+                ulong stamp = process::uptime();
+                while( x->get()==0 && process::uptime()-stamp < 5000 ){ worker::delay( 10 ); }
+                if( x->get()==1 ){ TEST_DONE(); }
+                              TEST_FAIL();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -0,0 +1,258 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+#include <nodepp/worker.h>
+#include <nodepp/tcp.h>
+#include <sys/socket.h>
+
+using namespace nodepp;
+
+namespace TEST { namespace KERNEL {
+
+    struct fd_t {
+        int fd; ptr_t<bool> wait = new bool(0);
+        int  get_fd()     const noexcept { return fd;    }
+        bool is_closed()  const noexcept { return false; }
+        bool is_waiting() const noexcept { return *wait; }
+    };
+
+    void TEST_RUNNER(){
+        ptr_t<uint> totl = new uint(0);
+        ptr_t<uint> done = new uint(0);
+        ptr_t<uint> err  = new uint(0);
+        ptr_t<uint> skp  = new uint(0);
+
+        auto test = TEST_CREATE();
+
+        TEST_ADD( test, "TEST 1 | kernel read wakeup", [](){
+            try { kernel_t ev; int sv[2]; fd_t a;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = sv[0]; ptr_t<int> x = new int(0);
+
+                  ev.poll_add( a, POLL_STATE::READ | POLL_STATE::EDGE, [=](){
+                      char buf[8]; int c=::read( a.fd, buf, 8 );
+                      if( c>0 ){ *x += c; } *a.wait = c<0; return 1;
+                  }, 1000UL );
+
+                  ::write( sv[1], "hello", 5 );
+                  while( *x < 5 ){ ev.next(); }
+
+                  ::close( sv[0] ); ::close( sv[1] );
+             if ( *x != 5    ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 2 | kernel full-duplex fd", [](){
+            try { kernel_t ev; int sv[2]; fd_t a, w;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = w.fd = sv[0]; int b = sv[1];
+
+                  ptr_t<int> wr = new int(0);
+                  ptr_t<int> rd = new int(0);
+                  ptr_t<int> x  = new int(0);
+
+                  ev.poll_add( w, POLL_STATE::WRITE | POLL_STATE::EDGE, [=](){
+                      if( ++*wr == 5 ){ ::write( b, "hello", 5 ); }
+                      return 1;
+                  });
+
+                  ev.poll_add( a, POLL_STATE::READ | POLL_STATE::EDGE, [=](){
+                      char buf[8]; int c=0; ++*rd;
+                      while( ( c=::read( a.fd, buf, 8 ) )>0 ){ *x += c; }
+                      *a.wait = true; return 1;
+                  });
+
+                  while( *wr < 20 ){ ev.next(); }
+
+                  ::close( sv[0] ); ::close( sv[1] );
+             if ( *x != 5    ){ throw 0; }
+             if ( *rd > 3    ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | kernel busy poll", [](){
+            try { kernel_t ev; int sv[2]; fd_t a;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = sv[0]; ptr_t<int> x = new int(0);
+                  ev.set_busy_poll( 500UL );
+
+                  ev.poll_add( a, POLL_STATE::READ | POLL_STATE::EDGE, [=](){
+                      char buf[8]; int c=::read( a.fd, buf, 8 );
+                      if( c>0 ){ *x += c; } *a.wait = c<0; return 1;
+                  }, 1000UL );
+
+                  ::write( sv[1], "hello", 5 );
+                  while( *x < 5 ){ ev.next(); }
+
+                  ::close( sv[0] ); ::close( sv[1] );
+                  auto bp = ev.get_busy_poll();
+             if ( *x != 5        ){ throw 0; }
+             if ( bp.hit == 0    ){ throw 0; }
+             if ( bp.limit != 500){ throw 0; }
+                                  TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | kernel task budget", [](){
+            try { kernel_t ev; int sv[2]; fd_t a;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = sv[0]; ptr_t<int> x = new int(0), y = new int(0);
+                  ev.set_budget( 8 );
+
+                  ev.poll_add( a, POLL_STATE::READ | POLL_STATE::EDGE, [=](){
+                      char buf[8]; int c=::read( a.fd, buf, 8 );
+                      if( c>0 ){ *x += c; } *a.wait = c<0; return 1;
+                  }, 1000UL );
+
+                  ev.loop_add([=](){ ++*y; return 1; });
+                  for( int z=0; z<4; ++z ){ ev.next(); }
+             if ( ev.get_budget().count != 4 ){ throw 0; }
+
+                  ::write( sv[1], "hello", 5 );
+                  for( int z=0; z<40 && *x<5; ++z ){ ev.next(); }
+
+                  ::close( sv[0] ); ::close( sv[1] );
+             if ( *x != 5 ){ throw 0; }
+             if ( *y <  8 ){ throw 0; }
+                            TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 5 | kernel cross-thread post", [](){
+            try { auto hd = process::handle(); auto id = worker::pid();
+                  ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+                  ptr_t<atomic_t<ulong>> y = new atomic_t<ulong>(0);
+
+                  worker::add([=](){
+                      for( int z=0; z<100; ++z ){ hd.post([=](){
+                      if ( worker::pid()==id ){ x->add(1); } y->add(1); return -1;
+                      }); }
+                  return -1; });
+
+                  while( y->get()<100 ){ process::next(); }
+             if ( x->get() != 100 ){ throw 0; }
+                                   TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 6 | kernel busy poll decay", [](){
+            try { kernel_t ev; int sv[2]; fd_t a;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = sv[0]; ptr_t<int> x = new int(0);
+                  ev.set_busy_poll( 500UL ); *a.wait = true;
+
+                  ev.poll_add( a, POLL_STATE::READ, [=](){
+                      char buf[8]; int c=::read( a.fd, buf, 8 );
+                      if( c>0 ){ *x += c; } *a.wait = c<0; return 1;
+                  });
+
+                  ev.loop_add( coroutine::add( COROUTINE(){
+                  coBegin while( true ){ coDelay( 1 ); } coFinish
+                  }));
+
+                  for( int z=0; z<20; ++z ){ ev.next(); }
+                  auto bp = ev.get_busy_poll();
+             if ( bp.budget != 0 || bp.miss < 9 ){ throw 0; }
+
+                  ::write( sv[1], "hello", 5 );
+                  while( *x < 5 ){ ev.next(); }
+                  bp = ev.get_busy_poll(); ::close( sv[0] ); ::close( sv[1] );
+             if ( bp.budget == 0 ){ throw 0; }
+                                  TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 7 | kernel reused fd", [](){
+        #ifdef NODEPP_POLL_URING
+            TEST_SKIP(); /* no fd table: a closed fd's poll completes on its own */
+        #endif
+            try { kernel_t ev; int sv[2], sw[2]; fd_t a, b;
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv );
+                  a.fd = sv[0]; *a.wait = true;
+                  ev.poll_add( a, POLL_STATE::READ, [=](){ return 1; });
+                  ::close( sv[0] ); ::close( sv[1] );
+
+                  socketpair( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sw );
+                  b.fd = sw[0]; *b.wait = true;
+                  ev.poll_add( b, POLL_STATE::READ, [=](){ return 1; });
+                  auto st = ev.get_stats(); ::close( sw[0] ); ::close( sw[1] );
+             if ( a.fd != b.fd      ){ throw 0; }
+             if ( st.kv_queue != 1  ){ throw 0; }
+                                  TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 8 | kernel handle outlives its loop", [](){
+            try { ptr_t<loop_handle_t> hd = new loop_handle_t();
+                  ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+
+                  worker::add([=](){ *hd = process::handle(); x->set(1); return -1; });
+                  while( x->get()==0 ){ worker::delay( 1 ); }
+
+                  /* the handle only shares the worker's post box, so its loop *
+                   * still goes away with the thread and late posts fail.      */
+
+                  ulong stamp = process::uptime();
+                  while( hd->post([](){ return -1; })!=-1 ){ worker::delay( 1 );
+                  if   ( process::uptime()-stamp > 2000 ){ throw 0; } }
+                                   TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 9 | kernel ring-fed tcp socket", [](){
+            try { auto x = type::bind( atomic_t<int>(0) );
+
+                /* io_uring accepts and receives ahead of the reader; the bytes *
+                 * must still reach read() in order, split writes included.     */
+
+                worker::add([=](){ ptr_t<int> y = new int(0); tcp_t cln = tcp::client();
+                    ptr_t<string_t> msg = new string_t(); ptr_t<int> fed = new int(0);
+
+                    auto srv = tcp::server(); srv.onSocket([=]( socket_t cli ){
+                        *fed = cli.set_feed(); *msg += cli.get_borrow(); cli.del_borrow();
+                        cli.onData([=]( string_t data ){ *msg += data; if( msg->size()>=10 ) 
+                                { *y = *msg=="helloworld" ? 1 : 2; } });
+                        stream::pipe( cli );
+                    });
+
+                    srv.listen( "localhost", 8913, [=]( socket_t ){
+                        cln.onConnect([=]( socket_t cli ){ cli.write( "hello" );
+                            process::add( coroutine::add( COROUTINE(){
+                            coBegin ; coDelay( 100 ); cli.write( "world" ); coFinish
+                            }));
+                        }); cln.connect( "localhost", 8913 );
+                    });
+
+                    process::add( coroutine::add( COROUTINE(){
+                    coBegin ; coDelay( 2000 ); if( *y==0 ){ *y = 3; } coFinish
+                    }));
+
+                    while( *y==0 ){ process::next(); } 
+                #ifdef NODEPP_POLL_URING
+                    if( *fed != 1 ){ *y = 4; }
+                #endif
+                    srv.close(); cln.close(); process::clear(); *x = *y;
+
+                return -1; });
+
+                ulong stamp = process::uptime();
+                while( x->get()==0 && process::uptime()-stamp < 5000 ){ worker::delay( 10 ); }
+                if( x->get()==1 ){ TEST_DONE(); }
+                              TEST_FAIL();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        test.onClose.once([=](){
+            console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
+        });
+
+        test.onDone([=](){ (*done)++; (*totl)++; });
+        test.onFail([=](){ (*err)++;  (*totl)++; });
+        test.onSkip([=](){ (*skp)++;  (*totl)++; });
+
+        TEST_AWAIT( test );
+
+    }
+
+}}
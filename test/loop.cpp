@@ -1,5 +1,7 @@
 #include <nodepp/nodepp.h>
 #include <nodepp/loop.h>
+#include <nodepp/worker.h>
+#include <nodepp/channel.h>
 #include <nodepp/test.h>
 
 using namespace nodepp;
@@ -41,6 +43,89 @@ namespace TEST { namespace LOOP {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 2 | EVloop cached clock", [](){
+            try { kernel_t krn; ptr_t<ulong> x = new ulong(0), y = new ulong(0);
+                  krn.loop_add([=](){ *x = process::now(); process::delay( 5 ); 
+                                      *y = process::now(); return -1; }); 
+                  process::get_clock( true ); krn.next(); krn.next(); 
+             if ( *x != *y              ){ throw 0; }
+             if ( process::now() <= *x  ){ throw 0; }
+             if ( process::now() >  process::uptime() ){ throw 0; }
+                                         TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | EVloop clock off the loop", [](){
+            try { ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+                  worker::add([=](){ ulong y = process::now(); process::delay( 5 );
+                                     x->set( process::now() > y ? 1 : 2 ); return -1; });
+                  while( x->get()==0 ){ worker::delay( 1 ); }
+             if ( x->get() != 1 ){ throw 0; }
+                                         TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | EVloop stats", [](){
+            try { loop_t ev; ptr_t<int> x = new int(0);
+                  ev.add([=](){ return ++*x < 3 ? 1 : -1; }); 
+                  ev.next(); ev.next(); ev.next(); auto st = ev.get_stats();
+             if ( st.ev_queue != 1 ){ throw 0; }
+             if ( st.blocked  != 0 ){ throw 0; }
+            #ifdef NODEPP_LOOP_STATS
+             if ( st.iteration!= 3 ){ throw 0; }
+             if ( st.task     != 3 ){ throw 0; }
+             if ( st.histogram[0] + st.histogram[1] == 0 ){ throw 0; }
+            #else
+             if ( st.iteration!= 0 || st.task != 0 ){ throw 0; }
+            #endif
+                                    TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 5 | EVloop priority lanes", [](){
+            try { loop_t ev; ptr_t<string_t> x = new string_t();
+                  ev.add( TASK_PRIORITY::IDLE, [=](){ *x += "c"; return -1; }); 
+                  ev.add( /*---------------*/  [=](){ *x += "b"; return -1; }); 
+                  ev.add( TASK_PRIORITY::HIGH, [=](){ *x += "a"; return -1; }); 
+                  for( int y=0; y<4; ++y ){ ev.next( false ); }
+             if ( *x != "ab"  ){ throw 0; }
+                  for( int y=0; y<4; ++y ){ ev.next(); }
+             if ( *x != "abc" ){ throw 0; }
+                                TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 6 | EVloop high lane starvation", [](){
+            try { loop_t ev; ptr_t<int> x = new int(0);
+                  ev.add( TASK_PRIORITY::HIGH, [=](){ return 1; }); 
+                  ev.add( [=](){ ++*x; return 1; }); 
+                  for( int y=0; y<20; ++y ){ ev.next(); }
+             if ( *x != 2 ){ throw 0; }
+                            TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 7 | EVloop nested wait", [](){
+            try { auto x = type::bind( atomic_t<int>(0) ); channel_t<int> ch;
+
+                /* the task blocks in read(), which pumps process::next() from *
+                 * inside it; that nested poll must not wait forever.          */
+
+                  worker::add([=](){
+                      process::add([=](){ auto y = ch.read(); 
+                          x->set( !y.null() && *y==10 ? 1 : 2 ); return -1; });
+                      while( x->get()==0 ){ process::next(); } process::clear();
+                  return -1; });
+
+                  worker::add([=](){ worker::delay( 200 ); ch.write( 10 ); return -1; });
+
+                  ulong stamp = process::uptime();
+                  while( x->get()==0 && process::uptime()-stamp < 5000 ){ worker::delay( 10 ); }
+             if ( x->get() != 1 ){ throw 0; }
+                            TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
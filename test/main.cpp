@@ -8,15 +8,20 @@ using namespace nodepp;
 #include "any.cpp"
 #include "ptr.cpp"
 #include "map.cpp"
+#include "heap.cpp"
+#include "ring.cpp"
+#include "wheel.cpp"
 #include "json.cpp"
 #include "task.cpp"
 #include "path.cpp"
 #include "loop.cpp"
+#include "kernel.cpp"
 #include "wait.cpp"
 #include "file.cpp"
 #include "http.cpp"
 #include "tuple.cpp"
 #include "worker.cpp"
+#include "scheduler.cpp"
 #include "cookie.cpp"
 #include "event.cpp"
 #include "query.cpp"
@@ -38,9 +43,13 @@ void onMain(){
     TEST::ANY     ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::PTR     ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::MAP     ::TEST_RUNNER(); conio::log("\n---\n");
+    TEST::HEAP    ::TEST_RUNNER(); conio::log("\n---\n");
+    TEST::RING    ::TEST_RUNNER(); conio::log("\n---\n");
+    TEST::WHEEL   ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::TASK    ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::PATH    ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::LOOP    ::TEST_RUNNER(); conio::log("\n---\n");
+    TEST::KERNEL  ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::WAIT    ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::FILE    ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::HTTP    ::TEST_RUNNER(); conio::log("\n---\n");
@@ -51,6 +60,7 @@ void onMain(){
     TEST::JSON    ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::ARRAY   ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::WORKER  ::TEST_RUNNER(); conio::log("\n---\n");
+    TEST::SCHEDULER::TEST_RUNNER(); conio::log("\n---\n");
     TEST::QUEUE   ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::REGEX   ::TEST_RUNNER(); conio::log("\n---\n");
     TEST::STRING  ::TEST_RUNNER(); conio::log("\n---\n");
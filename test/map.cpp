@@ -4,6 +4,14 @@
 
 using namespace nodepp;
 
+struct MAP_KEY { int x, y;
+    bool operator==( const MAP_KEY& other ) const { return x==other.x && y==other.y; }
+};
+
+namespace nodepp { template<> struct hasher_t<MAP_KEY> {
+    ulong operator()( const MAP_KEY& key ) const noexcept { return hash::get( (ullong) key.x << 32 | (uint) key.y ); }
+};}
+
 namespace TEST { namespace MAP {
 
     void TEST_RUNNER(){
@@ -76,6 +84,34 @@ namespace TEST { namespace MAP {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 6 | map growth", [](){
+            try {
+                map_t<int, int> map; int& one = map[1];
+                for( int x=0; x<5000; ++x ){ map[x] = x*2; }
+                for( int x=0; x<5000; x+=2 ){ map.erase(x); }
+                for( int x=0; x<5000; x+=4 ){ map[x] = x*3; }
+                auto keys = map.keys();
+
+             if ( map.size() != 3750 || keys[0] != 1 || keys[2499] != 4999 || keys[2500] != 0 ){ throw 0; }
+                one = 7; if( map[1] != 7 ){ throw 0; } map[1] = 2;
+             for( int x=0; x<5000; ++x ){ bool has = x%2==1 || x%4==0;
+             if ( map.has(x) != has ){ throw 0; }
+             if ( has && map[x] != ( x%2==1 ? x*2 : x*3 ) ){ throw 0; }}
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 7 | map typed hashing", [](){
+            try {
+                map_t<MAP_KEY, int> map; map[{ 1, 2 }] = 3; map[{ 2, 1 }] = 4;
+             if ( map.size() != 2 || map[{ 1, 2 }] != 3 || map.has({ 1, 3 }) ){ throw 0; }
+             if ( hasher_t<string_t>()( "key" ) != hasher_t<string_t>()( string_t( "key" ) ) ){ throw 0; }
+             if ( hasher_t<string_t>()( "key" ) == hasher_t<string_t>()( "kez" ) ){ throw 0; }
+             if ( hasher_t<long>()( 10 ) == hasher_t<long>()( 11 ) ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
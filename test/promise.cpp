@@ -1,6 +1,7 @@
 #include <nodepp/nodepp.h>
 #include <nodepp/promise.h>
 #include <nodepp/timer.h>
+#include <nodepp/offload.h>
 
 using namespace nodepp;
 
@@ -110,6 +111,33 @@ namespace TEST { namespace PROMISE {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 7 | promise offload", [](){
+            try { auto id = worker::pid();
+
+                auto data = process::offload([=](){ 
+                  return worker::pid()==id ? 0 : 100; 
+                }).await();
+
+                if( !data.has_value() ){ TEST_FAIL(); }
+                if( data.value()!=100 ){ TEST_FAIL(); }
+
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 8 | promise offload (fail)", [](){
+            try {
+
+                auto data = process::offload([=](){ 
+                  throw except_t( "error" ); return 0; 
+                }).await();
+
+                if( data.has_value() ){ TEST_FAIL(); }
+
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -43,6 +43,50 @@ namespace TEST { namespace PTR {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 13 | ptr make", [](){
+            try {
+                auto str = ptr::make<string_t>( "hello", 5UL );
+                auto num = ptr::make<uint>( 1000U );
+                auto cpy = str;
+             if ( *str != "hello" ){ throw 0; }
+             if ( *num != 1000    ){ throw 0; }
+             if ( cpy.count() != 2 ){ throw 0; }
+                  str.reset();
+             if ( *cpy != "hello" ){ throw 0; }
+                ptr_t<string_t> arr ( 3UL, string_t( "abc" ) );
+             if ( arr.size() != 3 || arr[2] != "abc" ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 14 | ptr arena", [](){
+            try {
+                arena_t mem; ptr_t<string_t> str; queue_t<int> que;
+                mem.use([&](){
+                    str = ptr::make<string_t>( "hello" );
+                    que = queue_t<int>(); que.push( 10 ); que.push( 20 );
+                });
+             if ( mem.size() == 0  ){ throw 0; }
+             if ( mem.count() <= 1 ){ throw 0; }
+             if ( *str != "hello" || que.size() != 2 ){ throw 0; }
+                  str.reset(); que = queue_t<int>();
+             if ( mem.count() != 1 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 15 | ptr arena outside", [](){
+            try {
+                arena_t mem; ptr_t<int> num; queue_t<int> que;
+                mem.use([&](){ arena::outside([&](){
+                    num = ptr::make<int>( 10 ); que = queue_t<int>(); que.push( 20 );
+                }); });
+             if ( mem.size() != 0 || mem.count() != 1 ){ throw 0; }
+             if ( *num != 10 || que.first()->data != 20 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -132,6 +132,29 @@ namespace TEST { namespace QUEUE {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 13 | queue slab nodes", [](){
+            try { queue_t<string_t> arr; 
+             if ( !arr.set_slab( true ) ){ throw 0; }
+                  for( int x=0; x<100; ++x ){ arr.push( string::to_string(x) ); arr.shift(); arr.push( "a" ); }
+             if ( arr.size() != 100 || arr.last()->data != "a" ){ throw 0; }
+             if ( arr.set_slab( false ) ){ throw 0; } arr.clear();
+             if ( !arr.set_slab( false ) ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 14 | queue large sorting", [](){
+            try { queue_t<ulong> arr; ulong seed = 7;
+                  for( ulong x=0; x<100000; ++x ){ seed = seed * 6364136223846793005UL + 1; arr.push( ( seed >> 33 ) % 1000 ); }
+                  auto out = arr.sort([=]( ulong a, ulong b ){ return a<b; }); auto n = out.first();
+             if ( out.size() != arr.size() || out.first()->prev != nullptr ){ throw 0; }
+             while( n->next != nullptr ){
+             if ( n->next->data < n->data || n->next->prev != n ){ throw 0; } n = n->next; }
+             if ( out.last() != n ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -0,0 +1,61 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+namespace TEST { namespace RING {
+
+    void TEST_RUNNER(){
+        ptr_t<uint> totl = new uint(0);
+        ptr_t<uint> done = new uint(0);
+        ptr_t<uint> err  = new uint(0);
+        ptr_t<uint> skp  = new uint(0);
+
+        auto test = TEST_CREATE();
+
+        TEST_ADD( test, "TEST 1 | ring fifo", [](){
+            try { ring_t<uint> arr;
+             if ( !arr.empty() ){ throw 0; }
+                  arr.push( 10 ); arr.push( 20 ); arr.push( 30 );
+             if ( arr.size() != 3 || arr.first() != 10 || arr.last() != 30 ){ throw 0; }
+                  arr.shift();
+             if ( arr.size() != 2 || arr.first() != 20 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 2 | ring wrap and growth", [](){
+            try { ring_t<uint> arr; uint next=0, head=0;
+                  for( uint x=0; x<1000; x++ ){
+                       arr.push( next++ ); arr.push( next++ );
+                  if ( arr.first() != head ){ throw 0; } arr.shift(); head++; }
+             if ( arr.size() != 1000 || arr.capacity() != 1024 ){ throw 0; }
+                  for( uint x=0; x<arr.size(); x++ ){ if( arr[x] != head+x ){ throw 0; } }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | ring both ends", [](){
+            try { ring_t<string_t> arr;
+                  arr.push( "b" ); arr.unshift( "a" ); arr.push( "c" ); arr.unshift( "z" );
+                  arr.pop(); string_t out; for( auto& x: arr ){ out += x; }
+             if ( out != "zab" || arr.data().size() != 3 ){ throw 0; }
+                  arr.clear();
+             if ( !arr.empty() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        test.onClose.once([=](){
+            console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
+        });
+
+        test.onDone([=](){ (*done)++; (*totl)++; });
+        test.onFail([=](){ (*err)++;  (*totl)++; });
+        test.onSkip([=](){ (*skp)++;  (*totl)++; });
+
+        TEST_AWAIT( test );
+
+    }
+
+}}
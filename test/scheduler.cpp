@@ -0,0 +1,76 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/scheduler.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+namespace TEST { namespace SCHEDULER {
+
+    void TEST_RUNNER(){
+        ptr_t<uint> totl = new uint(0);
+        ptr_t<uint> done = new uint(0);
+        ptr_t<uint> err  = new uint(0);
+        ptr_t<uint> skp  = new uint(0);
+
+        auto test = TEST_CREATE();
+
+        TEST_ADD( test, "TEST 1 | deque push pop steal", [](){
+            try { deque_t<int> dq( 4 ); int x=0;
+                  dq.push( 1 ); dq.push( 2 ); dq.push( 3 ); dq.push( 4 );
+             if ( dq.push( 5 )         ){ throw 0; }
+             if ( !dq.pop  ( x ) || x!=4 ){ throw 0; }
+             if ( !dq.steal( x ) || x!=1 ){ throw 0; }
+             if ( dq.size() != 2       ){ throw 0; }
+                  dq.pop( x ); dq.pop( x );
+             if ( dq.pop( x ) || dq.steal( x ) ){ throw 0; }
+                                         TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 2 | scheduler await", [](){
+            try { scheduler_t sch( 3 ); ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+                  for( int y=0; y<200; ++y ){ ptr_t<int> n = new int(0);
+                  sch.add([=](){ if( ++*n<3 ){ return 1; } x->add(1); return -1; }); }
+                  sch.await();
+             if ( x->get() != 200 ){ throw 0; }
+                                    TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | scheduler nested and delayed", [](){
+            try { scheduler_t sch( 2 ); ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+                  sch.add([=](){
+                      for( int y=0; y<50; ++y ){ sch.add([=](){ x->add(1); return -1; }); }
+                  return -1; });
+                  sch.add( coroutine::add( COROUTINE(){
+                  coBegin coDelay( 20 ); x->add(1); coFinish
+                  }));
+                  sch.await();
+             if ( x->get() != 51 ){ throw 0; }
+                                   TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | scheduler stops on destruction", [](){
+            try { ptr_t<atomic_t<ulong>> x = new atomic_t<ulong>(0);
+                { scheduler_t sch( 2 ); sch.emit();
+                  sch.add([=](){ x->add(1); return 1; });
+                  worker::delay( 10 ); } ulong y = x->get(); worker::delay( 10 );
+             if ( y==0 || x->get() != y ){ throw 0; }
+                                  TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        test.onClose.once([=](){
+            console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
+        });
+
+        test.onDone([=](){ (*done)++; (*totl)++; });
+        test.onFail([=](){ (*err)++;  (*totl)++; });
+        test.onSkip([=](){ (*skp)++;  (*totl)++; });
+
+        TEST_AWAIT( test );
+
+    }
+
+}}
@@ -92,6 +92,33 @@ namespace TEST { namespace STRING {
             } catch ( ... ) { TEST_FAIL(); }
         });
 
+        TEST_ADD( test, "TEST 11 | string inline storage", [](){
+            try { string_t arr1 = "0123456789"; string_t arr2 = arr1;
+                  arr2[0] = 'x'; arr1 += "0123456789ABCDEF";
+             if ( arr2 != "x123456789" ){ throw 0; }
+             if ( arr1 != "01234567890123456789ABCDEF" ){ throw 0; }
+             if ( arr1.slice( 20 ) != "ABCDEF" ){ throw 0; }
+                  arr1.erase( 10, arr1.size() );
+             if ( arr1 != "0123456789" || arr1.size() != 10 ){ throw 0; }
+             if ( strlen( arr1.get() ) != 10 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 12 | string capacity", [](){
+            try { string_t arr; arr.reserve( 100 );
+             if ( arr.capacity() < 100 || !arr.empty() ){ throw 0; }
+                  for( int x=0; x<1000; x++ ){ arr.push( 'a' ); }
+             if ( arr.size() != 1000 || strlen( arr.get() ) != 1000 ){ throw 0; }
+                  auto cpy = arr; arr += "b"; arr.erase( 0 );
+             if ( cpy.size() != 1000 || cpy[999] != 'a' ){ throw 0; }
+             if ( arr.size() != 1000 || arr[999] != 'b' ){ throw 0; }
+                  arr.shrink_to_fit();
+             if ( arr.capacity() != arr.size() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
         test.onClose.once([=](){
             console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
         });
@@ -0,0 +1,77 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+namespace TEST { namespace WHEEL {
+
+    void TEST_RUNNER(){
+        ptr_t<uint> totl = new uint(0);
+        ptr_t<uint> done = new uint(0);
+        ptr_t<uint> err  = new uint(0);
+        ptr_t<uint> skp  = new uint(0);
+
+        auto test = TEST_CREATE();
+
+        TEST_ADD( test, "TEST 1 | wheel slot wrap", [](){
+            try { ulong now = process::now(); wheel_t whl; ulong out=0;
+                  int a=1, b=2; auto cb = [&]( void* x ){ out = out*10 + *(int*)x; };
+                  whl.add( now + 500*16, &a ); whl.add( now + 520*16, &b );
+             if ( whl.size() != 2 || whl.next( now, cb ) != 0 ){ throw 0; }
+             if ( whl.next( now + 510*16, cb ) != 1 || out != 1 ){ throw 0; }
+             if ( whl.next( now + 530*16, cb ) != 1 || out != 12 ){ throw 0; }
+             if ( !whl.empty() ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 2 | wheel cancel", [](){
+            try { ulong now = process::now(); wheel_t whl; ulong out=0;
+                  int a=1, b=2; auto cb = [&]( void* x ){ out = out*10 + *(int*)x; };
+                  auto x = whl.add( now + 64, &a ); whl.add( now + 64, &b );
+                  whl.off( x );
+             if ( whl.size() != 1 ){ throw 0; }
+             if ( whl.next( now + 128, cb ) != 1 || out != 2 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 3 | wheel beyond one turn", [](){
+            try { ulong now = process::now(); wheel_t whl; ulong out=0;
+                  int a=1; auto cb = [&]( void* x ){ out = out*10 + *(int*)x; };
+                  whl.add( now + 1000*16, &a );
+             if ( whl.next( now + 600*16, cb ) != 0 || whl.size() != 1 ){ throw 0; }
+             if ( whl.next( now + 999*16, cb ) != 0 || out != 0 ){ throw 0; }
+             if ( whl.next( now +1001*16, cb ) != 1 || out != 1 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        TEST_ADD( test, "TEST 4 | wheel delay hint", [](){
+            try { ulong now = process::now(); wheel_t whl; ulong out=0;
+                  int a=1, b=2; auto cb = [&]( void* x ){ out = out*10 + *(int*)x; };
+                  whl.add( now + 5000, &a );
+             if ( whl.get_delay() < 4900 || whl.get_delay() > 5100 ){ throw 0; }
+                  auto x = whl.add( now + 200, &b );
+             if ( whl.get_delay() < 100  || whl.get_delay() > 300  ){ throw 0; }
+                  whl.off( x );
+             if ( whl.get_delay() < 4900 || whl.get_delay() > 5100 ){ throw 0; }
+             if ( whl.next( now + 5100, cb ) != 1 || out != 1 ){ throw 0; }
+             if ( whl.get_delay() != -1 ){ throw 0; }
+                              TEST_DONE();
+            } catch ( ... ) { TEST_FAIL(); }
+        });
+
+        test.onClose.once([=](){
+            console::log("\nRESULT | total:", *totl, "| passed:", *done, "| error:", *err, "| skipped:", *skp );
+        });
+
+        test.onDone([=](){ (*done)++; (*totl)++; });
+        test.onFail([=](){ (*err)++;  (*totl)++; });
+        test.onSkip([=](){ (*skp)++;  (*totl)++; });
+
+        TEST_AWAIT( test );
+
+    }
+
+}}